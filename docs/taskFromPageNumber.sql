@@ -1,7 +1,12 @@
-SELECT (row_id - 1) / ? /* per page*/ + 1 AS page_num,
-       (row_id - 1) % ? AS page_pos
-FROM (SELECT id, row_number() over (ORDER BY status_id, name) AS row_id
+WITH target AS (SELECT id, parent_id, status_id, name
+                FROM task
+                WHERE id = ? /* task id */
+                  AND status_id = ? /* status filter */)
+SELECT task_rank / ? /* per page*/ + 1 AS page_num,
+       task_rank % ? AS page_pos
+FROM (SELECT COUNT(*) AS task_rank
       FROM task
-      WHERE parent_id IS NULL
-        AND status_id = ?)
-WHERE id = ?;
+      WHERE task.parent_id IS (SELECT parent_id FROM target)
+        AND task.status_id = (SELECT status_id FROM target)
+        AND (task.name, task.id) < (SELECT name, id FROM target))
+WHERE EXISTS (SELECT 1 FROM target);
@@ -1,12 +1,15 @@
-SELECT id,
-       task_id,
-       min(starting_time)  AS starting_time,
-       max(finishing_time) AS finishing_time,
-       created_at,
-       updated_at
-FROM null_set_worktime
-WHERE (starting_time < ?1 AND finishing_time > ?2)
-   OR starting_time BETWEEN ?1 AND ?2
-   OR finishing_time BETWEEN ?1 AND ?2
-GROUP BY task_id
-ORDER BY starting_time, starting_time - finishing_time;
\ No newline at end of file
+SELECT worktime.id,
+       worktime.task_id,
+       min(worktime.starting_time)                                            AS starting_time,
+       max(coalesce(worktime.finishing_time, unixepoch(DATETIME('now')))) AS finishing_time,
+       worktime.created_at,
+       worktime.updated_at
+FROM worktime_rtree
+         INNER JOIN worktime ON worktime.id = worktime_rtree.id
+WHERE worktime_rtree.starting_time < ?2
+  AND worktime_rtree.finishing_time > ?1
+  AND worktime.starting_time < ?2
+  AND coalesce(worktime.finishing_time, unixepoch(DATETIME('now'))) > ?1
+GROUP BY worktime.task_id
+ORDER BY min(worktime.starting_time),
+         min(worktime.starting_time) - max(coalesce(worktime.finishing_time, unixepoch(DATETIME('now'))));
\ No newline at end of file
@@ -0,0 +1,7 @@
+INSERT INTO settings(setting_key, value)
+VALUES ('query log level', 'inherit'),
+       ('query log sampling', '1'),
+       ('slow query threshold', 'off');
+
+INSERT INTO migrate (applied)
+VALUES (2);
\ No newline at end of file
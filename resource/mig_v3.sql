@@ -0,0 +1,10 @@
+INSERT INTO settings(setting_key, value)
+VALUES ('journal mode', 'wal'),
+       ('synchronous', 'normal'),
+       ('cache size (KiB)', '8192'),
+       ('mmap size (MiB)', '64'),
+       ('temp store', 'memory'),
+       ('busy timeout (ms)', '5000');
+
+INSERT INTO migrate (applied)
+VALUES (3);
\ No newline at end of file
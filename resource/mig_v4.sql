@@ -0,0 +1,66 @@
+DROP TRIGGER IF EXISTS trigger_task_closure_insert;
+DROP TRIGGER IF EXISTS trigger_task_closure_delete;
+DROP TRIGGER IF EXISTS trigger_task_closure_reparent;
+DROP INDEX IF EXISTS idx_task_closure_descendant;
+DROP TABLE IF EXISTS task_closure;
+
+CREATE TABLE task_closure
+(
+    ancestor   INTEGER NOT NULL,
+    descendant INTEGER NOT NULL,
+    depth      INTEGER NOT NULL,
+    PRIMARY KEY (ancestor, descendant)
+) WITHOUT ROWID;
+
+CREATE INDEX idx_task_closure_descendant ON task_closure (descendant, depth);
+
+CREATE TRIGGER trigger_task_closure_insert
+    AFTER INSERT
+    ON task
+BEGIN
+    INSERT INTO task_closure(ancestor, descendant, depth)
+    VALUES (NEW.id, NEW.id, 0);
+    INSERT INTO task_closure(ancestor, descendant, depth)
+    SELECT ancestor, NEW.id, depth + 1
+    FROM task_closure
+    WHERE descendant = NEW.parent_id;
+END;
+
+CREATE TRIGGER trigger_task_closure_delete
+    AFTER DELETE
+    ON task
+BEGIN
+    DELETE
+    FROM task_closure
+    WHERE descendant IN (SELECT descendant FROM task_closure WHERE ancestor = OLD.id);
+END;
+
+CREATE TRIGGER trigger_task_closure_reparent
+    AFTER UPDATE OF parent_id
+    ON task
+    WHEN OLD.parent_id IS NOT NEW.parent_id
+BEGIN
+    DELETE
+    FROM task_closure
+    WHERE descendant IN (SELECT descendant FROM task_closure WHERE ancestor = NEW.id)
+      AND ancestor NOT IN (SELECT descendant FROM task_closure WHERE ancestor = NEW.id);
+    INSERT INTO task_closure(ancestor, descendant, depth)
+    SELECT super.ancestor, sub.descendant, super.depth + sub.depth + 1
+    FROM task_closure AS super
+             CROSS JOIN task_closure AS sub
+    WHERE super.descendant = NEW.parent_id
+      AND sub.ancestor = NEW.id;
+END;
+
+INSERT INTO task_closure(ancestor, descendant, depth)
+WITH RECURSIVE closure(ancestor, descendant, depth) AS (SELECT id, id, 0
+                                                        FROM task
+                                                        UNION ALL
+                                                        SELECT closure.ancestor, task.id, closure.depth + 1
+                                                        FROM closure
+                                                                 INNER JOIN task ON task.parent_id = closure.descendant)
+SELECT ancestor, descendant, depth
+FROM closure;
+
+INSERT INTO migrate (applied)
+VALUES (4);
\ No newline at end of file
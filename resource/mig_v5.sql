@@ -0,0 +1,115 @@
+DROP TRIGGER IF EXISTS trigger_task_worktime_total_task_insert;
+DROP TRIGGER IF EXISTS trigger_task_worktime_total_task_delete;
+DROP TRIGGER IF EXISTS trigger_task_worktime_total_task_reparent;
+DROP TRIGGER IF EXISTS trigger_task_worktime_total_insert;
+DROP TRIGGER IF EXISTS trigger_task_worktime_total_update;
+DROP TRIGGER IF EXISTS trigger_task_worktime_total_delete;
+DROP VIEW IF EXISTS total_worktime_group_by_task;
+DROP TABLE IF EXISTS task_worktime_total;
+
+CREATE TABLE task_worktime_total
+(
+    task_id          INTEGER PRIMARY KEY REFERENCES task (id) ON DELETE CASCADE,
+    total_worktime   INTEGER NOT NULL DEFAULT 0,
+    subtree_worktime INTEGER NOT NULL DEFAULT 0
+);
+
+CREATE TRIGGER trigger_task_worktime_total_task_insert
+    AFTER INSERT
+    ON task
+BEGIN
+    INSERT INTO task_worktime_total(task_id)
+    VALUES (NEW.id);
+END;
+
+CREATE TRIGGER trigger_task_worktime_total_task_delete
+    BEFORE DELETE
+    ON task
+    WHEN OLD.parent_id IS NULL OR EXISTS (SELECT 1 FROM task WHERE id = OLD.parent_id)
+BEGIN
+    UPDATE task_worktime_total
+    SET subtree_worktime = subtree_worktime -
+                           (SELECT subtree_worktime FROM task_worktime_total WHERE task_id = OLD.id)
+    WHERE task_id IN (SELECT ancestor FROM task_closure WHERE descendant = OLD.id AND depth > 0);
+END;
+
+CREATE TRIGGER trigger_task_worktime_total_task_reparent
+    AFTER UPDATE OF parent_id
+    ON task
+    WHEN OLD.parent_id IS NOT NEW.parent_id
+BEGIN
+    UPDATE task_worktime_total
+    SET subtree_worktime = subtree_worktime -
+                           (SELECT subtree_worktime FROM task_worktime_total WHERE task_id = NEW.id)
+    WHERE task_id IN (SELECT ancestor FROM task_closure WHERE descendant = OLD.parent_id);
+    UPDATE task_worktime_total
+    SET subtree_worktime = subtree_worktime +
+                           (SELECT subtree_worktime FROM task_worktime_total WHERE task_id = NEW.id)
+    WHERE task_id IN (SELECT ancestor FROM task_closure WHERE descendant = NEW.parent_id);
+END;
+
+CREATE TRIGGER trigger_task_worktime_total_insert
+    AFTER INSERT
+    ON worktime
+    WHEN NEW.finishing_time IS NOT NULL
+BEGIN
+    UPDATE task_worktime_total
+    SET total_worktime = total_worktime + (NEW.finishing_time - NEW.starting_time)
+    WHERE task_id = NEW.task_id;
+    UPDATE task_worktime_total
+    SET subtree_worktime = subtree_worktime + (NEW.finishing_time - NEW.starting_time)
+    WHERE task_id IN (SELECT ancestor FROM task_closure WHERE descendant = NEW.task_id);
+END;
+
+CREATE TRIGGER trigger_task_worktime_total_update
+    AFTER UPDATE OF task_id, starting_time, finishing_time
+    ON worktime
+BEGIN
+    UPDATE task_worktime_total
+    SET total_worktime = total_worktime - COALESCE(OLD.finishing_time - OLD.starting_time, 0)
+    WHERE task_id = OLD.task_id;
+    UPDATE task_worktime_total
+    SET subtree_worktime = subtree_worktime - COALESCE(OLD.finishing_time - OLD.starting_time, 0)
+    WHERE task_id IN (SELECT ancestor FROM task_closure WHERE descendant = OLD.task_id);
+    UPDATE task_worktime_total
+    SET total_worktime = total_worktime + COALESCE(NEW.finishing_time - NEW.starting_time, 0)
+    WHERE task_id = NEW.task_id;
+    UPDATE task_worktime_total
+    SET subtree_worktime = subtree_worktime + COALESCE(NEW.finishing_time - NEW.starting_time, 0)
+    WHERE task_id IN (SELECT ancestor FROM task_closure WHERE descendant = NEW.task_id);
+END;
+
+CREATE TRIGGER trigger_task_worktime_total_delete
+    AFTER DELETE
+    ON worktime
+    WHEN OLD.finishing_time IS NOT NULL AND EXISTS (SELECT 1 FROM task WHERE id = OLD.task_id)
+BEGIN
+    UPDATE task_worktime_total
+    SET total_worktime = total_worktime - (OLD.finishing_time - OLD.starting_time)
+    WHERE task_id = OLD.task_id;
+    UPDATE task_worktime_total
+    SET subtree_worktime = subtree_worktime - (OLD.finishing_time - OLD.starting_time)
+    WHERE task_id IN (SELECT ancestor FROM task_closure WHERE descendant = OLD.task_id);
+END;
+
+CREATE VIEW total_worktime_group_by_task AS
+SELECT task.parent_id parent_task,
+       task_worktime_total.task_id,
+       task_worktime_total.total_worktime
+FROM task_worktime_total
+         INNER JOIN task ON task.id = task_worktime_total.task_id;
+
+INSERT INTO task_worktime_total(task_id, total_worktime)
+SELECT task.id, COALESCE(SUM(worktime.finishing_time - worktime.starting_time), 0)
+FROM task
+         LEFT OUTER JOIN worktime ON worktime.task_id = task.id
+GROUP BY task.id;
+
+UPDATE task_worktime_total
+SET subtree_worktime = (SELECT COALESCE(SUM(total.total_worktime), 0)
+                        FROM task_closure
+                                 INNER JOIN task_worktime_total AS total ON total.task_id = task_closure.descendant
+                        WHERE task_closure.ancestor = task_worktime_total.task_id);
+
+INSERT INTO migrate (applied)
+VALUES (5);
\ No newline at end of file
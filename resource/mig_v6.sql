@@ -0,0 +1,43 @@
+DROP TRIGGER IF EXISTS trigger_worktime_rtree_insert;
+DROP TRIGGER IF EXISTS trigger_worktime_rtree_update;
+DROP TRIGGER IF EXISTS trigger_worktime_rtree_delete;
+DROP TABLE IF EXISTS worktime_rtree;
+
+CREATE VIRTUAL TABLE worktime_rtree USING rtree
+(
+    id,
+    starting_time,
+    finishing_time
+);
+
+CREATE TRIGGER trigger_worktime_rtree_insert
+    AFTER INSERT
+    ON worktime
+BEGIN
+    INSERT INTO worktime_rtree(id, starting_time, finishing_time)
+    VALUES (NEW.id, NEW.starting_time, COALESCE(NEW.finishing_time, 253402300799));
+END;
+
+CREATE TRIGGER trigger_worktime_rtree_update
+    AFTER UPDATE OF starting_time, finishing_time
+    ON worktime
+BEGIN
+    UPDATE worktime_rtree
+    SET starting_time  = NEW.starting_time,
+        finishing_time = COALESCE(NEW.finishing_time, 253402300799)
+    WHERE id = NEW.id;
+END;
+
+CREATE TRIGGER trigger_worktime_rtree_delete
+    AFTER DELETE
+    ON worktime
+BEGIN
+    DELETE FROM worktime_rtree WHERE id = OLD.id;
+END;
+
+INSERT INTO worktime_rtree(id, starting_time, finishing_time)
+SELECT id, starting_time, COALESCE(finishing_time, 253402300799)
+FROM worktime;
+
+INSERT INTO migrate (applied)
+VALUES (6);
\ No newline at end of file
@@ -0,0 +1,7 @@
+DROP INDEX IF EXISTS idx_worktime_active;
+DROP VIEW IF EXISTS null_set_worktime;
+
+CREATE INDEX idx_worktime_active ON worktime (id) WHERE finishing_time IS NULL;
+
+INSERT INTO migrate (applied)
+VALUES (7);
\ No newline at end of file
@@ -0,0 +1,67 @@
+DROP TRIGGER IF EXISTS trigger_task_child_count_insert;
+DROP TRIGGER IF EXISTS trigger_task_child_count_delete;
+DROP TRIGGER IF EXISTS trigger_task_child_count_update;
+DROP TABLE IF EXISTS task_child_count;
+DROP INDEX IF EXISTS idx_task_children;
+DROP INDEX IF EXISTS idx_task_status_id_per_parent;
+
+CREATE INDEX idx_task_children ON task (parent_id, status_id, name, id);
+
+CREATE TABLE task_child_count
+(
+    parent_id   INTEGER NOT NULL,
+    status_id   INTEGER NOT NULL,
+    child_count INTEGER NOT NULL DEFAULT 0,
+    PRIMARY KEY (parent_id, status_id)
+) WITHOUT ROWID;
+
+CREATE TRIGGER trigger_task_child_count_insert
+    AFTER INSERT
+    ON task
+BEGIN
+    INSERT INTO task_child_count(parent_id, status_id, child_count)
+    VALUES (coalesce(NEW.parent_id, 0), NEW.status_id, 1)
+    ON CONFLICT (parent_id, status_id) DO UPDATE SET child_count = child_count + 1;
+END;
+
+CREATE TRIGGER trigger_task_child_count_delete
+    AFTER DELETE
+    ON task
+BEGIN
+    UPDATE task_child_count
+    SET child_count = child_count - 1
+    WHERE parent_id = coalesce(OLD.parent_id, 0)
+      AND status_id = OLD.status_id;
+    DELETE
+    FROM task_child_count
+    WHERE parent_id = coalesce(OLD.parent_id, 0)
+      AND status_id = OLD.status_id
+      AND child_count <= 0;
+END;
+
+CREATE TRIGGER trigger_task_child_count_update
+    AFTER UPDATE OF parent_id, status_id
+    ON task
+    WHEN OLD.parent_id IS NOT NEW.parent_id OR OLD.status_id IS NOT NEW.status_id
+BEGIN
+    UPDATE task_child_count
+    SET child_count = child_count - 1
+    WHERE parent_id = coalesce(OLD.parent_id, 0)
+      AND status_id = OLD.status_id;
+    DELETE
+    FROM task_child_count
+    WHERE parent_id = coalesce(OLD.parent_id, 0)
+      AND status_id = OLD.status_id
+      AND child_count <= 0;
+    INSERT INTO task_child_count(parent_id, status_id, child_count)
+    VALUES (coalesce(NEW.parent_id, 0), NEW.status_id, 1)
+    ON CONFLICT (parent_id, status_id) DO UPDATE SET child_count = child_count + 1;
+END;
+
+INSERT INTO task_child_count(parent_id, status_id, child_count)
+SELECT coalesce(parent_id, 0), status_id, COUNT(*)
+FROM task
+GROUP BY coalesce(parent_id, 0), status_id;
+
+INSERT INTO migrate (applied)
+VALUES (8);
\ No newline at end of file
@@ -0,0 +1,16 @@
+SELECT task.id,
+       task.parent_id,
+       task.name,
+       task.detail,
+       task.status_id,
+       task.created_at,
+       task.updated_at,
+       COALESCE(total.total_worktime, 0)   AS task_worktime,
+       COALESCE(total.subtree_worktime, 0) AS subtree_worktime,
+       EXISTS (SELECT 1
+               FROM task_closure
+               WHERE ancestor = task.id
+                 AND descendant = ?2)      AS is_active_task_family
+FROM task
+         LEFT JOIN task_worktime_total AS total ON total.task_id = task.id
+WHERE task.id = ?1;
\ No newline at end of file
@@ -25,7 +25,8 @@
 #include <chrono>
 #include "../elements/GanttChartLine.h"
 #include "../utilities/TimezoneUtil.h"
-#include "../page/SettingsPage.h"
+#include "../core/SettingsStore.h"
+#include "../core/Logger.h"
 
 using namespace std::chrono_literals;
 
@@ -56,16 +57,16 @@ namespace components {
         _date_control->Add(_prev_day_button);
         _date_control->Add(_next_day_button);
 
-        pages::SettingsPage::registerEventOnChange("timezone", [&] { update(); });
+        // 登録はデストラクタで解除するため、破棄後に呼ばれることはない。
+        _timezone_listener = core::SettingsStore::subscribe("timezone", [this] { update(); });
 
         ftxui::MenuOption option = ftxui::MenuOption::Vertical();
         option.entries_option.transform = [&](const ftxui::EntryState& state) {
-            const auto tbl = _task_tbl.getTable();
             const auto id = stoll(state.label);
-            if (!tbl.contains(id) || !_worktime_data.contains(id))
+            if (!_task_names.contains(id) || !_worktime_data.contains(id))
                 return elements::GanttChartLine(
                     state.label, 0, {}, state.focused);
-            return elements::GanttChartLine(tbl.at(id).name,
+            return elements::GanttChartLine(_task_names.at(id),
                                             _date_sec.count(),
                                             _worktime_data.at(id),
                                             state.focused);
@@ -82,6 +83,8 @@ namespace components {
         Add(_component);
     }
 
+    GanttChartTimelineBase::~GanttChartTimelineBase() { core::SettingsStore::unsubscribe(_timezone_listener); }
+
     ftxui::Element GanttChartTimelineBase::OnRender()
     {
         return vbox(
@@ -89,66 +92,87 @@ namespace components {
                 _prev_day_button->Render(),
                 ftxui::separator(),
                 ftxui::filler(),
-                ftxui::text(_date_str),
+                ftxui::text(_is_loading ? _date_str + " (loading)" : _date_str),
                 ftxui::filler(),
                 ftxui::separator(),
                 _next_day_button->Render()
             ),
             ftxui::separator(),
             elements::GanttChartTimeMeasure(),
-            _gantt_chart->Render() | ftxui::frame | ftxui::vscroll_indicator
+            _gantt_chart_cache.render(_load_generation, [&] { return _gantt_chart->Render(); })
+            | ftxui::frame | ftxui::vscroll_indicator
         );
     }
 
-    void GanttChartTimelineBase::update()
+    void GanttChartTimelineBase::update() { _load().detach(); }
+
+    core::db::AsyncTask<> GanttChartTimelineBase::_load()
     {
         const std::chrono::sys_days d(_date);
         const std::chrono::sys_seconds sec(d);
         const auto difference = util::tz::fetchDifferenceSeconds();
         const auto starting_at = sec.time_since_epoch().count() - difference;
         const auto finishing_at = (sec + 86400s).time_since_epoch().count() - difference;
-        _date_sec = sec.time_since_epoch();
-
-        _task_tbl.selectRecords(
-            "id IN (SELECT task_id FROM null_set_worktime WHERE (starting_time < ?1 AND finishing_time > ?2)"
-            " OR starting_time BETWEEN ?1 AND ?2"
-            " OR finishing_time BETWEEN ?1 AND ?2)", {
-                {core::db::ColType::T_INTEGER, starting_at},
-                {core::db::ColType::T_INTEGER, finishing_at}
-            });
-
-        // 対象のタスクを抽出
-        _worktime_target_task_tbl.selectWorktimeExistTaskFromPeriod(starting_at, finishing_at);
-        _task_keys.clear();
-        _task_keys.reserve(_worktime_target_task_tbl.getKeys().size());
-        const auto tmp_task_tbl = _worktime_target_task_tbl.getTable();
-        for (const auto i : _worktime_target_task_tbl.getKeys()) {
-            if (!tmp_task_tbl.contains(i)) continue;
-            _task_keys.emplace_back(
-                std::to_string(tmp_task_tbl.at(i).task_id)
-            );
-        }
-
-        // 対象の作業時間を抽出
-        _worktime_tbl.selectRecords("(starting_time < ?1 AND finishing_time > ?2)"
-                                    " OR starting_time BETWEEN ?1 AND ?2"
-                                    " OR finishing_time BETWEEN ?1 AND ?2",
-                                    {
-                                        {core::db::ColType::T_INTEGER, starting_at},
-                                        {core::db::ColType::T_INTEGER, finishing_at}
-                                    });
-        _worktime_data.clear();
-        const auto tmp_worktime_tbl = _worktime_tbl.getTable();
-        for (const auto i : _worktime_tbl.getKeys()) {
-            if (tmp_worktime_tbl.contains(i)) {
-                _worktime_data.try_emplace(tmp_worktime_tbl.at(i).task_id,
-                                           std::vector<std::pair<long long, long long>>{});
-                _worktime_data.at(tmp_worktime_tbl.at(i).task_id).emplace_back(
-                    tmp_worktime_tbl.at(i).starting_time + difference,
-                    tmp_worktime_tbl.at(i).finishing_time + difference
-                );
+        const auto date_sec = sec.time_since_epoch();
+        const unsigned long long generation = ++_load_generation;
+        const std::weak_ptr<char> lifetime = _lifetime_token;
+        _is_loading = true;
+
+        // データベースの読み込みはワーカースレッドで行い、UIの状態には結果のみを反映する。
+        auto loaded = co_await core::db::runOnDBWorker([starting_at, finishing_at, difference] {
+            // タスクと作業時間を同じ時点の状態から読み取り、UIスレッドの書き込みを待機しない。
+            const core::db::DBManager::ReadScope read_scope;
+            LoadedData data;
+            core::db::TaskTable task_tbl;
+            task_tbl.selectRecords(
+                std::format("id IN (SELECT task_id FROM worktime WHERE {})", WORKTIME_OVERLAP_CONDITION), {
+                    {core::db::ColType::T_INTEGER, starting_at},
+                    {core::db::ColType::T_INTEGER, finishing_at}
+                });
+            for (const auto& [id, task] : task_tbl.getTable()) { data.task_names.try_emplace(id, task.name); }
+
+            // 対象のタスクを抽出
+            core::db::WorktimeTable target_task_tbl;
+            target_task_tbl.selectWorktimeExistTaskFromPeriod(starting_at, finishing_at);
+            data.task_keys.reserve(target_task_tbl.getKeys().size());
+            const auto& tmp_task_tbl = target_task_tbl.getTable();
+            for (const auto i : target_task_tbl.getKeys()) {
+                if (!tmp_task_tbl.contains(i)) continue;
+                data.task_keys.emplace_back(std::to_string(tmp_task_tbl.at(i).task_id));
             }
-        }
+
+            // 対象の作業時間を抽出
+            // 作業時間は全件を保持せずに1件ずつ読み取り、描画用のデータのみを構築する。
+            // 終了していない作業時間は、現在時刻までとして表示する。
+            const long long now = std::chrono::system_clock::now().time_since_epoch() / 1s;
+            const int err = core::db::WorktimeTable().forEachRecord(
+                WORKTIME_OVERLAP_CONDITION,
+                {
+                    {core::db::ColType::T_INTEGER, starting_at},
+                    {core::db::ColType::T_INTEGER, finishing_at}
+                }, "",
+                [&](const core::db::Worktime& worktime_) {
+                    const long long finishing_time = worktime_.finishing_time == 0 ? now : worktime_.finishing_time;
+                    data.worktime_data[worktime_.task_id].emplace_back(
+                        worktime_.starting_time + difference,
+                        finishing_time + difference
+                    );
+                    return true;
+                }, MAX_WORKTIME_ROWS_PER_DAY);
+            if (core::db::DBManager::getErrorPos(err) == core::db::DBManager::ErrorPrefix::ROW_LIMIT_REACHED)
+                Logger::warning(std::format("worktime rows exceeded {}. the rest is not displayed.",
+                                            MAX_WORKTIME_ROWS_PER_DAY), "GanttChartTimelineBase");
+            return data;
+        });
+
+        // 破棄された場合や、読み込み中に日付が変更された場合は、古い結果を反映しない。
+        if (lifetime.expired() || generation != _load_generation) co_return;
+        _date_sec = date_sec;
+        _task_names = std::move(loaded.task_names);
+        _task_keys = std::move(loaded.task_keys);
+        _worktime_data = std::move(loaded.worktime_data);
+        _is_loading = false;
+        _gantt_chart_cache.markDirty();
     }
 
     void GanttChartTimelineBase::updateDateStr() { _date_str = std::format("{:%F}", _date); }
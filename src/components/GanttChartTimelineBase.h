@@ -33,7 +33,10 @@
 #define GANNTCHARTTIMELINEBASE_H
 #include <ftxui/component/component.hpp>
 
+#include "../core/AsyncDB.h"
 #include "../core/DBManager.h"
+#include "../core/RenderCache.h"
+#include "../core/SettingsStore.h"
 
 namespace components {
     /**
@@ -45,6 +48,8 @@ namespace components {
     public:
         GanttChartTimelineBase();
 
+        ~GanttChartTimelineBase() override;
+
         ftxui::Element OnRender() override;
 
         void update();
@@ -56,6 +61,33 @@ namespace components {
         void decreaseDay();
 
     private:
+        /**
+         * @brief 表示する日付のデータをワーカースレッドで読み込み、読み込み後にUIスレッドで反映します。
+         */
+        core::db::AsyncTask<> _load();
+
+        /**
+         * @brief ワーカースレッドで読み込んだ、ガントチャートの表示に必要なデータ。
+         */
+        struct LoadedData {
+            std::unordered_map<long long, std::string> task_names{};
+            std::vector<std::string> task_keys{};
+            std::unordered_map<long long, std::vector<std::pair<long long, long long>>> worktime_data{};
+        };
+
+        /**
+         * @brief 1日分のガントチャートに読み込む作業時間の最大件数。
+         */
+        static constexpr size_t MAX_WORKTIME_ROWS_PER_DAY = 10000;
+        /**
+         * @brief 作業時間が期間[?1, ?2)と重なる条件です。worktime_rtreeで候補を絞り込み、実際の値で再確認します。
+         * @details 期間全体を覆う作業時間や、終了していない作業時間も対象になります。
+         */
+        static constexpr auto WORKTIME_OVERLAP_CONDITION =
+            "id IN (SELECT id FROM worktime_rtree WHERE starting_time < ?2 AND finishing_time > ?1)"
+            " AND starting_time < ?2"
+            " AND coalesce(finishing_time, unixepoch(DATETIME('now'))) > ?1";
+
         std::chrono::year_month_day _date{};
         std::chrono::seconds _date_sec{};
 
@@ -64,14 +96,22 @@ namespace components {
         ftxui::Component _gantt_chart;
         ftxui::Component _next_day_button;
         ftxui::Component _prev_day_button;
-        core::db::WorktimeTable _worktime_tbl;
-        core::db::WorktimeTable _worktime_target_task_tbl;
-        core::db::TaskTable _task_tbl;
+        std::unordered_map<long long, std::string> _task_names{};
         std::unordered_map<long long, std::vector<std::pair<long long, long long>>> _worktime_data{};
         std::string _date_str;
 
         std::vector<std::string> _task_keys;
         int _entered_task{};
+
+        // 読み込みの世代。最新の読み込み以外の結果は破棄する。
+        unsigned long long _load_generation{0};
+        bool _is_loading{false};
+        // ガントチャートの描画結果。読み込んだデータを反映した時に作り直す。
+        core::RenderCache _gantt_chart_cache;
+        // タイムゾーンの変更通知の登録。破棄時に解除する。
+        core::SettingsStore::ListenerId _timezone_listener{0};
+        // コルーチンの再開時に、このコンポーネントが破棄されていないか確認するためのトークン。
+        std::shared_ptr<char> _lifetime_token{std::make_shared<char>()};
     };
 } // components
 
@@ -23,6 +23,7 @@
 #include "TodoListPageComponents.h"
 
 #include <ftxui/component/component.hpp>
+#include "../../core/TaskTreeCache.h"
 #include "../../core/TodoAndTimeCardApp.h"
 #include "../../utilities/Utilities.h"
 
@@ -41,6 +42,8 @@ namespace components {
     ftxui::Element ActiveTaskBase::OnRender()
     {
         using namespace ftxui;
+        // 表示中のみタイマーを進める。
+        if (isActivated()) _active_timer.markVisible();
         const auto active_status = isActivated()
                                        ? text("Active(" + getTimerText() + "): "
                                            + util::ellipsisString(getActiveTaskName(), 36))
@@ -71,7 +74,7 @@ namespace components {
 
     const std::string& ActiveTaskBase::getActiveTaskName() const { return _active_task_name; }
 
-    const std::string& ActiveTaskBase::getTimerText() { return _active_timer.getText(); }
+    std::string ActiveTaskBase::getTimerText() const { return _active_timer.getText(); }
 
     std::chrono::seconds ActiveTaskBase::getSeconds() const
     {
@@ -92,7 +95,7 @@ namespace components {
         table.selectActiveTask();
         if (table.getTable().empty() || table.getKeys().empty()) return;
         const auto worktime = table.getTable().at(table.getKeys().front());
-        const auto [fetch_task_err, task] = core::db::TaskTable::fetchTask(worktime.task_id);
+        const auto [fetch_task_err, task] = core::db::TaskTreeCache::fetchTask(worktime.task_id);
         _active_task_name = task.name;
         _active_task_id = task.id;
         _active_timer.start();
@@ -24,6 +24,7 @@
 #include "TodoListPageComponents.h"
 
 #include <ftxui/component/component.hpp>
+#include "../../core/TaskTreeCache.h"
 #include "../../utilities/Utilities.h"
 
 namespace components {
@@ -38,10 +39,12 @@ namespace components {
         taskStatusToggleOption.focused_entry = &_focused_status;
         _task_status_toggle = ftxui::Menu(&TaskDetailBase::TASK_STATUS, &_selected_status, taskStatusToggleOption);
 
-        _task_detail_input = ftxui::Input(&_task_detail, "detail", {
-                                              .multiline = true
-                                          }
-        ) | ftxui::frame | ftxui::size(ftxui::HEIGHT, ftxui::EQUAL, 10) | ftxui::size(ftxui::WIDTH, ftxui::EQUAL, 56);
+        _task_detail_input = ftxui::CatchEvent(ftxui::Input(&_task_detail, "detail", {
+                                                                .multiline = true
+                                                            }), [&](const ftxui::Event&) {
+                                                   // 詳細を読み込むまでは、入力を読み込んだ値で上書きしないよう受け付けない。
+                                                   return !_is_detail_loaded;
+                                               }) | ftxui::frame | ftxui::size(ftxui::HEIGHT, ftxui::EQUAL, 10) | ftxui::size(ftxui::WIDTH, ftxui::EQUAL, 56);
 
         _worktime_summary = ftxui::Renderer([&] {
             std::string str_time{};
@@ -55,6 +58,8 @@ namespace components {
             if (_active_task->getActiveTaskId() == this->_tasklist_view_base->_data.getSelectedTaskId())
                 tmp_total_task_worktime += _active_task->getSeconds();
             str_time += " (In: " + util::timeTextFromSeconds(tmp_total_task_worktime) + ")";
+            // 読み込み中は、前回の値を表示したまま読み込み中であることを示す。
+            if (_is_loading_worktime) str_time += " (loading)";
             return ftxui::text(str_time);
         });
 
@@ -69,9 +74,8 @@ namespace components {
 
         _deactivate_task_button = ftxui::Button("deactivate", [&] {
             _active_task->deactivate();
-            updateTotalWorktime();
-            updateTaskWorktime();
             _is_active_task_family = false;
+            reloadWorktime();
         }) | ftxui::Maybe([&] { return this->_isCurrentTaskActivated(); });
 
         _update_button = ftxui::Button("update", [&] { _updateTask(); });
@@ -114,7 +118,10 @@ namespace components {
                             separator()
                         ),
                         separator(),
-                        _task_detail_input->Render(),
+                        // 読み込むまでは、空の詳細と区別できるよう読み込み中と表示する。
+                        _is_detail_loaded
+                            ? _task_detail_input->Render()
+                            : text("(loading)") | dim | size(HEIGHT, EQUAL, 10) | size(WIDTH, EQUAL, 56),
                         separator(),
                         _worktime_summary->Render(),
                         separator(),
@@ -134,35 +141,67 @@ namespace components {
             _task_name = "";
             _selected_status = 0;
             _task_detail = "";
+            _is_detail_loaded = false;
             _total_worktime = 0s;
+            _task_worktime = 0s;
+            // 読み込み中の結果は反映しない。
+            _worktime_generation->fetch_add(1);
+            _is_loading_worktime = false;
             return;
         }
         _task_name = _tasklist_view_base->_data.getSelectedTaskName();
         _selected_status = static_cast<int>(status) - 1;
         _focused_status = static_cast<int>(status) - 1;
-        _task_detail = _tasklist_view_base->_data.getSelectedTaskDetail();
-        updateTotalWorktime();
-        updateTaskWorktime();
-        const long long id = _tasklist_view_base->_data.getSelectedTaskId();
-        _is_active_task_family = core::db::TaskTable::computeIsSiblings(_active_task->getActiveTaskId(), id);
+        // 詳細は、キャッシュにあればすぐに表示し、なければ作業時間と共にワーカースレッドで読み込む。
+        const auto detail = _tasklist_view_base->_data.getSelectedTaskDetail();
+        _task_detail = detail.value_or("");
+        _is_detail_loaded = detail.has_value();
+        reloadWorktime();
     }
 
-    void TaskDetailBase::updateTotalWorktime()
+    void TaskDetailBase::reloadWorktime() { _loadWorktime().detach(); }
+
+    core::db::AsyncTask<> TaskDetailBase::_loadWorktime()
     {
         using namespace std::chrono_literals;
-        const auto [err, seconds] = core::db::TaskTable::computeTotalWorktime(
-            _tasklist_view_base->_data.getSelectedTaskId());
-        if (err != 0) _total_worktime = 0s;
-        else _total_worktime = seconds;
+        const long long id = _tasklist_view_base->_data.getSelectedTaskId();
+        const long long active_task_id = _active_task->getActiveTaskId();
+        const unsigned long long generation = _worktime_generation->fetch_add(1) + 1;
+        const std::weak_ptr<char> lifetime = _lifetime_token;
+
+        // 前回の書き込み以降に読み込んだタスクであれば、ワーカースレッドを待たずに反映する。
+        if (const auto cached = core::db::TaskTreeCache::findDetailSnapshot(id, active_task_id)) {
+            _applyDetailSnapshot(*cached);
+            co_return;
+        }
+        _is_loading_worktime = true;
+
+        // カーソルを連続して移動している間は読み込まず、最後に選択されたタスクのみを読み込む。
+        const auto loaded = co_await core::db::runOnDBWorkerAfter(
+            WORKTIME_LOAD_DEBOUNCE,
+            [id, active_task_id, generation, latest_generation = _worktime_generation]
+            () -> std::optional<core::db::TaskDetailSnapshot> {
+                if (latest_generation->load() != generation) return std::nullopt;
+                const auto [err, snapshot] = core::db::TaskTreeCache::fetchDetailSnapshot(id, active_task_id);
+                // 読み込めなかった場合は、作業時間を0として表示する。
+                return err == 0 ? snapshot : core::db::TaskDetailSnapshot();
+            });
+
+        // 破棄された場合や、読み込み中に別のタスクが選択された場合は、古い結果を反映しない。
+        if (lifetime.expired() || !loaded || generation != _worktime_generation->load()) co_return;
+        _applyDetailSnapshot(*loaded);
     }
 
-    void TaskDetailBase::updateTaskWorktime()
+    void TaskDetailBase::_applyDetailSnapshot(const core::db::TaskDetailSnapshot& snapshot_)
     {
-        using namespace std::chrono_literals;
-        const auto [err, seconds] = core::db::TaskTable::fetchWorktime(
-            _tasklist_view_base->_data.getSelectedTaskId());
-        if (err != 0) _task_worktime = 0s;
-        else _task_worktime = seconds;
+        _total_worktime = snapshot_.subtree_worktime;
+        _task_worktime = snapshot_.task_worktime;
+        _is_active_task_family = snapshot_.is_active_task_family;
+        if (!_is_detail_loaded && snapshot_.task) {
+            _task_detail = snapshot_.task->detail;
+            _is_detail_loaded = true;
+        }
+        _is_loading_worktime = false;
     }
 
     void TaskDetailBase::_deleteTask()
@@ -170,7 +209,7 @@ namespace components {
         if (_selected_status != 3) return;
         const auto id = this->_tasklist_view_base->_data.getSelectedTaskId();
         if (core::db::TaskTable::deleteTask(id) != 0) return;
-        this->_tasklist_view_base->_data.resetPage();
+        this->_tasklist_view_base->_data.resetPosition();
         selectedTaskChanged();
     }
 
@@ -179,12 +218,20 @@ namespace components {
         const long long id = _tasklist_view_base->_data.getSelectedTaskId();
         if (id <= 0) return;
         core::db::TaskTable table;
-        const int err = table.usePlaceholderUniSql("UPDATE task SET name = ?, detail = ?, status_id = ? WHERE id = ?", {
-                                                       {core::db::ColType::T_TEXT, _task_name},
-                                                       {core::db::ColType::T_TEXT, _task_detail},
-                                                       {core::db::ColType::T_INTEGER, _selected_status + 1},
-                                                       {core::db::ColType::T_INTEGER, id}
-                                                   });
+        // 詳細を読み込む前に更新された場合は、空の値で上書きしないよう詳細を除いて更新する。
+        const int err = _is_detail_loaded
+                            ? table.usePlaceholderUniSql(
+                                "UPDATE task SET name = ?, detail = ?, status_id = ? WHERE id = ?", {
+                                    {core::db::ColType::T_TEXT, _task_name},
+                                    {core::db::ColType::T_TEXT, _task_detail},
+                                    {core::db::ColType::T_INTEGER, _selected_status + 1},
+                                    {core::db::ColType::T_INTEGER, id}
+                                })
+                            : table.usePlaceholderUniSql("UPDATE task SET name = ?, status_id = ? WHERE id = ?", {
+                                                             {core::db::ColType::T_TEXT, _task_name},
+                                                             {core::db::ColType::T_INTEGER, _selected_status + 1},
+                                                             {core::db::ColType::T_INTEGER, id}
+                                                         });
         if (err != 0) return;
         _tasklist_view_base->_data.selectTask(id);
     }
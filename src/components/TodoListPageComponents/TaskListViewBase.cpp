@@ -22,9 +22,12 @@
 
 #include "TodoListPageComponents.h"
 
+#include <utility>
 #include <ftxui/component/component.hpp>
 #include <ftxui/component/event.hpp>
 #include "../custom_menu_entry.h"
+#include "../../core/TodoAndTimeCardApp.h"
+#include "../../decorator/PageDecorator.h"
 
 namespace components {
     TaskListViewBase::TaskListViewBase(
@@ -50,13 +53,6 @@ namespace components {
         // タスク操作・詳細画面
         _task_detail = TaskDetail();
 
-        // パジネーションメニュー
-        _pagination_button = ftxui::Container::Horizontal({});
-        _prev_button = PrevButton();
-        _next_button = NextButton();
-        _pagination_button->Add(_prev_button);
-        _pagination_button->Add(_next_button);
-
         const auto task_list_area = ftxui::Container::Vertical({});
         task_list_area->Add(_status_filter_toggle);
         task_list_area->Add(_task_list_menu);
@@ -69,12 +65,26 @@ namespace components {
         _main_component = ftxui::Container::Vertical({});
         _main_component->Add(current_task_menu);
         _main_component->Add(task_area);
-        _main_component->Add(_pagination_button);
         Add(_main_component);
+
+        // 一覧の行数は、端末の高さに合わせたページの高さから求める。
+        _data.setVisibleRows(decorator::pageHeight() - LIST_CHROME_ROWS);
     }
 
     ftxui::Element TaskListViewBase::OnRender()
     {
+        // 端末の大きさが変わった場合、描画中には一覧を読み込み直さず、UIスレッドへ渡した処理で反映する。
+        // この描画では、変更前の行数のまま表示する。
+        if (const int rows = decorator::pageHeight() - LIST_CHROME_ROWS;
+            rows != _data.getVisibleRows() && rows != _pending_visible_rows) {
+            const bool is_posted = _pending_visible_rows != 0;
+            _pending_visible_rows = rows;
+            if (!is_posted) {
+                core::TodoAndTimeCardApp::post([this, lifetime = std::weak_ptr<char>(_lifetime_token)] {
+                    if (!lifetime.expired()) _resizeList();
+                });
+            }
+        }
         return
             hbox(
                 vbox(
@@ -88,19 +98,11 @@ namespace components {
                     ftxui::separator(),
                     _status_filter_toggle->Render(),
                     ftxui::separator(),
-                    _task_list_menu->Render() | ftxui::reflect(_task_list_box),
+                    // タイマーのティックによる再描画では一覧は変わらないため、前回の描画結果を再利用する。
+                    _task_list_cache.render(_data.getRevision(), [&] { return _task_list_menu->Render(); })
+                    | ftxui::reflect(_task_list_box),
                     ftxui::separator(),
-                    ftxui::hcenter(
-                        ftxui::hbox(
-                            _prev_button->Render(),
-                            ftxui::hcenter(
-                                ftxui::text(
-                                    _data.formattedCurrentPage()
-                                )
-                            ),
-                            _next_button->Render()
-                        )
-                    )
+                    ftxui::hcenter(ftxui::text(_data.formattedPosition()))
                 ),
                 ftxui::separator(),
                 _task_detail->Render()
@@ -124,11 +126,15 @@ namespace components {
         button_option.label = "+";
         button_option.on_click = [&] {
             const auto parent_id = _data.getParentId();
-            const auto insert_err = core::db::TaskTable::newTask(parent_id);
-            if (insert_err != 0) return;
-            auto [select_err, task] = core::db::TaskTable::fetchLastTask(_data.getParentId());
-            if (select_err != 0) return;
-            _data.selectTask(task.id);
+            long long new_task_id = 0;
+            // 追加したタスクを確実に取得できるよう、追加と取得を1つのトランザクションで行う。
+            if (core::db::DBManager::transaction([&] {
+                if (const auto insert_err = core::db::TaskTable::newTask(parent_id); insert_err != 0) return insert_err;
+                auto [select_err, task] = core::db::TaskTable::fetchLastTask(parent_id);
+                new_task_id = task.id;
+                return select_err;
+            }) != 0) return;
+            _data.selectTask(new_task_id);
         };
 
         return ftxui::Button(button_option);
@@ -138,7 +144,7 @@ namespace components {
     {
         auto toggle = ftxui::MenuOption::Toggle();
         toggle.on_change = [&] {
-            _data.resetPage();
+            _data.resetPosition();
             _task_detail->selectedTaskChanged();
         };
         return ftxui::Menu(&TaskListViewData::TASK_FILTER_MODE, _data.getSelectedStatusFilter(), toggle);
@@ -159,13 +165,11 @@ namespace components {
             _task_detail->selectedTaskChanged();
         };
         task_list_option.entries_option.transform = [&](const ftxui::EntryState& state) {
-            const auto keys = _data.getItems()->getKeys();
-            if (_data.getTaskCount() <= 0 || state.index >= keys.size())
+            const TaskListRow* task = _data.getVisibleTask(state.index);
+            if (task == nullptr)
                 return customize::TodoListMenuEntryOptionTransform(state, core::db::Status::Not_Planned, true);
 
-            const auto status = static_cast<core::db::Status>(
-                _data.getItems()->getTable().at(keys.at(state.index)).status_id
-            );
+            const auto status = static_cast<core::db::Status>(task->status_id);
             return customize::TodoListMenuEntryOptionTransform(state, status, false);
         };
 
@@ -173,18 +177,17 @@ namespace components {
 
         return ftxui::CatchEvent(menu, [&](ftxui::Event event_) {
             if (event_.is_mouse()) {
+                // ホイールは選択中の行を保ったまま一覧をスクロールする。
                 if (const auto mouse = event_.mouse(); mouse.button ==
                     ftxui::Mouse::Button::WheelUp) {
-                    if (*_data.getSelectedTaskPtr() <= 0 &&
-                        _task_list_box.Contain(mouse.x, mouse.y)) {
-                        _data.scrollUpPrevPage();
+                    if (_task_list_box.Contain(mouse.x, mouse.y)) {
+                        _scroll(-WHEEL_SCROLL_ROWS);
                         return true;
                     }
                 }
                 else if (mouse.button == ftxui::Mouse::Button::WheelDown) {
-                    if (*_data.getSelectedTaskPtr() >= _data.per_page - 1 &&
-                        _task_list_box.Contain(mouse.x, mouse.y)) {
-                        _data.nextPage();
+                    if (_task_list_box.Contain(mouse.x, mouse.y)) {
+                        _scroll(WHEEL_SCROLL_ROWS);
                         return true;
                     }
                 }
@@ -198,32 +201,45 @@ namespace components {
                     }
                 }
             }
+            // 端の行からさらに移動する場合は、選択中の行を端に保ったままスクロールする。
+            // スクロールできない場合は、隣のコンポーネントへフォーカスを移せるようにイベントを処理しない。
             else if (event_ == ftxui::Event::ArrowDown) {
-                if (*_data.getSelectedTaskPtr() >= static_cast<int>(_data.getItems()->
-                                                                          getKeys().size()) - 1) {
-                    _pagination_button->TakeFocus();
-                    return true;
+                if (const int selected = *_data.getSelectedTaskPtr(); selected >= _data.getVisibleTaskCount() - 1) {
+                    if (_scroll(1)) return true;
+                    // 下にタスクのない行がある場合は、その行を選択しないようにイベントを処理済みとする。
+                    return selected < _data.getVisibleRows() - 1;
                 }
             }
+            else if (event_ == ftxui::Event::ArrowUp) {
+                if (*_data.getSelectedTaskPtr() <= 0) return _scroll(-1);
+            }
+            else if (event_ == ftxui::Event::PageDown) {
+                _scroll(_data.getVisibleRows());
+                return true;
+            }
+            else if (event_ == ftxui::Event::PageUp) {
+                _scroll(-_data.getVisibleRows());
+                return true;
+            }
             return false;
         });
     }
 
-    ftxui::Component TaskListViewBase::PrevButton()
+    std::shared_ptr<TaskDetailBase> TaskListViewBase::TaskDetail() { return ftxui::Make<TaskDetailBase>(this); }
+
+    bool TaskListViewBase::_scroll(const long long delta_)
     {
-        ftxui::ButtonOption prev_button_option = ftxui::ButtonOption::Ascii();
-        prev_button_option.label = "←";
-        prev_button_option.on_click = [&] { _data.prevPage(); };
-        return ftxui::Button(prev_button_option);
+        if (!_data.scrollBy(delta_)) return false;
+        _task_detail->selectedTaskChanged();
+        return true;
     }
 
-    ftxui::Component TaskListViewBase::NextButton()
+    void TaskListViewBase::_resizeList()
     {
-        ftxui::ButtonOption next_button_option = ftxui::ButtonOption::Ascii();
-        next_button_option.label = "→";
-        next_button_option.on_click = [&] { _data.nextPage(); };
-        return ftxui::Button(next_button_option);
+        const int rows = std::exchange(_pending_visible_rows, 0);
+        if (rows == 0) return;
+        const long long selected_id = _data.getSelectedTaskId();
+        if (!_data.setVisibleRows(rows)) return;
+        if (_data.getSelectedTaskId() != selected_id) _task_detail->selectedTaskChanged();
     }
-
-    std::shared_ptr<TaskDetailBase> TaskListViewBase::TaskDetail() { return ftxui::Make<TaskDetailBase>(this); }
 }
@@ -22,6 +22,11 @@
 
 #include "TodoListPageComponents.h"
 
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include "../../core/TaskTreeCache.h"
 #include "../../utilities/Utilities.h"
 
 namespace components {
@@ -38,144 +43,105 @@ namespace components {
                                                       })
     {
         _task_items = std::make_shared<core::db::TaskTable>(core::db::TaskTable());
-        resetPage();
+        resetPosition();
     }
 
     void TaskListViewData::updateTaskList()
     {
-        // 親タスク名と子タスクを取得する。
-        switch (
-            const auto [selelct_err, parent_name] = _task_items->fetchChildTasks(
-                _parent_id, _status_filter, _page, per_page);
-            selelct_err) {
-        case 1:
-            _on_error("Could not retrieve parent name.");
-            break;
-        case 2:
-            _on_error("Could not retrieve data.");
-            break;
-        default:
-            _parent_name = util::ellipsisString(parent_name, 55);
-            break;
+        const long long selected_id = getSelectedTaskId();
+        const int selected_row = _selected_task;
+        _loadWindow();
+        // タスクが減った場合は、末尾が表示されるようにスクロールする。
+        _clampScroll();
+        if (!_isViewportLoaded()) _loadWindow();
+        // 選択中のタスクの位置が変わった場合は、同じ行に表示されるようにスクロールして選択し直す。
+        long long index = _indexOf(selected_id);
+        if (index < 0 && selected_id > 0) {
+            // ウィンドウの外へ移動した場合は、タスクツリーのキャッシュから位置を求める。
+            core::db::TaskTable table;
+            if (const auto [err, location] = core::db::TaskTreeCache::locateTask(table, selected_id, _status_filter, 1);
+                err == 0 && location.parent_id == _parent_id)
+                index = location.page_num - 1;
         }
-
-        // ラベルを登録する。
-        _task_labels->clear();
-        _task_labels->resize(per_page, "");
-        const auto keys = _task_items->getKeys();
-        for (size_t i = 0; i < keys.size(); i++) {
-            _task_labels->at(i) = util::ellipsisString(_task_items->getTable().at(keys.at(i)).name, 57);
+        if (index >= 0) {
+            if (index < _scroll_top || index >= _scroll_top + _visible_rows) {
+                _scroll_top = index - selected_row;
+                _clampScroll();
+                if (!_isViewportLoaded()) _loadWindow();
+            }
+            _selected_task = static_cast<int>(index - _scroll_top);
+            _focused_task = _selected_task;
         }
-
-        // フォーカスを先頭に戻す。
-        _selected_task = 0;
-        _focused_task = 0;
+        _relabel();
+        _clampSelection();
+        _prefetch();
     }
 
     long long TaskListViewData::getSelectedTaskId() const
     {
-        const auto keys = _task_items->getKeys();
-        if (_selected_task < keys.size()) {
-            return _task_items->getTable().at(_task_items->getKeys().at(_selected_task)).id;
-        }
+        if (const TaskListRow* row = getVisibleTask(_selected_task)) return row->id;
         return -1;
     }
 
-    std::string TaskListViewData::getSelectedTaskName() const
+    const std::string& TaskListViewData::getSelectedTaskName() const
     {
-        const auto keys = _task_items->getKeys();
-        if (_selected_task < keys.size()) {
-            return _task_items->getTable().at(_task_items->getKeys().at(_selected_task)).name;
-        }
-        return "";
+        static const std::string empty{};
+        if (const TaskListRow* row = getVisibleTask(_selected_task)) return row->name;
+        return empty;
     }
 
     long long TaskListViewData::getSelectedTaskStatus() const
     {
-        const auto keys = _task_items->getKeys();
-        if (_selected_task < keys.size()) {
-            return _task_items->getTable().at(_task_items->getKeys().at(_selected_task)).status_id;
-        }
+        if (const TaskListRow* row = getVisibleTask(_selected_task)) return row->status_id;
         return -1;
     }
 
-    std::string TaskListViewData::getSelectedTaskDetail() const
+    std::optional<std::string> TaskListViewData::getSelectedTaskDetail() const
     {
-        const auto keys = _task_items->getKeys();
-        if (_selected_task < keys.size()) {
-            return _task_items->getTable().at(_task_items->getKeys().at(_selected_task)).detail;
-        }
-        return "";
-    }
-
-    void TaskListViewData::resetPage()
-    {
-        _page = 0;
-        nextPage();
-    }
-
-    void TaskListViewData::updatePageCount()
-    {
-        // 対象となる行数を取得
-        auto [count_err, count] = core::db::TaskTable::countChildTasks(
-            _parent_id, _status_filter
-        );
-        if (count_err != 0) {
-            _on_error("Failed to count children.");
-            return;
-        }
-        _tasks_count = count;
+        const long long id = getSelectedTaskId();
+        if (id <= 0) return std::nullopt;
+        return core::db::TaskTreeCache::findTaskDetail(id);
     }
 
-    void TaskListViewData::nextPage()
+    void TaskListViewData::resetPosition()
     {
-        updatePageCount();
-        // ページが範囲外にならないように、インクリメントする。
-        if (_page == 0 || isExistNextPage())
-            _page++;
-        else return;
-
-        // ページが変わった場合、データを更新する。
+        _scroll_top = 0;
+        _selected_task = 0;
+        _focused_task = 0;
         updateTaskList();
     }
 
-    void TaskListViewData::prevPage()
+    bool TaskListViewData::setVisibleRows(const int rows_)
     {
-        // ページが範囲外にならないように、デクリメントする。
-        if (isExistPrevPage()) { _page--; }
-        else return;
-
-        // ページが変わった場合、データを更新する。
-        updateTaskList();
+        const int rows = std::max(1, rows_);
+        if (rows == _visible_rows) return false;
+        // 選択中のタスクがビューポートに残るようにスクロールする。
+        const long long selected_index = _scroll_top + _selected_task;
+        _visible_rows = rows;
+        if (selected_index >= _scroll_top + _visible_rows) _scroll_top = selected_index - _visible_rows + 1;
+        _clampScroll();
+        _selected_task = static_cast<int>(selected_index - _scroll_top);
+        _focused_task = _selected_task;
+        _applyViewport();
+        return true;
     }
 
-    void TaskListViewData::scrollUpPrevPage()
+    int TaskListViewData::getVisibleRows() const { return _visible_rows; }
+
+    bool TaskListViewData::scrollBy(const long long delta_)
     {
-        if (!isExistPrevPage()) return;
-        prevPage();
-        if (const size_t task_count = _task_items->getKeys().size();
-            task_count != 0) {
-            _focused_task = static_cast<int>(task_count) - 1;
-            _selected_task = static_cast<int>(task_count) - 1;
-        }
+        const long long prev_scroll_top = _scroll_top;
+        _scroll_top += delta_;
+        _clampScroll();
+        if (_scroll_top == prev_scroll_top) return false;
+        _applyViewport();
+        return true;
     }
 
     void TaskListViewData::taskListOnChange()
     {
-        // 選択されているタスクが、存在しているタスクの数より多い場合
-        if (const size_t task_count = _task_items->getKeys().size();
-            _selected_task >= task_count) {
-            // タスクがないなら、0を常に選択する。
-            // タスクがあるなら、最後のタスクを選択し、次のコンポーネントへ移る。
-            if (task_count == 0) {
-                _selected_task = 0;
-                _focused_task = 0;
-            }
-            else {
-                _selected_task = static_cast<int>(task_count) - 1;
-                _focused_task = static_cast<int>(task_count) - 1;
-            }
-        }
+        _clampSelection();
+        _prefetch();
     }
 
     void TaskListViewData::taskListOnEnter()
@@ -184,31 +150,39 @@ namespace components {
         if (id <= 0) return;
         _parent_id = id;
         setStatusFilter(0);
-        resetPage();
+        resetPosition();
     }
 
     void TaskListViewData::selectTask(const long long task_id_)
     {
         setStatusFilter(0);
         if (task_id_ <= 0) return;
-        const auto [err, val] = core::db::TaskTable::fetchPageNumAndFocusFromTask(
-            task_id_, _status_filter, per_page);
+
+        // タスクの位置と、その位置を含むウィンドウをタスクツリーのキャッシュから取得する。
+        const int window_rows = _visible_rows * (WINDOW_MARGIN_SCREENS * 2 + 1);
+        const auto [err, location] = core::db::TaskTreeCache::locateTask(
+            *_task_items, task_id_, _status_filter, window_rows);
         if (err != 0) {
             _on_error("Failed to get current task.");
             return;
         }
-        const auto [page_num, page_pos] = val;
-        _page = static_cast<int>(page_num);
-        auto [fetch_parent_err, task] = core::db::TaskTable::fetchTask(task_id_);
-        if (fetch_parent_err != 0) {
-            _on_error("Failed to get current task record.");
-            return;
-        }
-        _parent_id = task.parent_id;
-        updatePageCount();
-        updateTaskList();
-        _focused_task = static_cast<int>(page_pos);
-        _selected_task = static_cast<int>(page_pos);
+        _window_begin = (location.page_num - 1) * window_rows;
+        _buildRows();
+        const bool is_same_parent = location.parent_id == _parent_id;
+        _parent_id = location.parent_id;
+        _parent_name = util::ellipsisString(location.page.parent_name, 55);
+        _tasks_count = location.page.total_count;
+        const long long index = _window_begin + location.page_pos;
+
+        // 既に表示されている場合はスクロールせず、そうでなければビューポートの中央に表示する。
+        if (!is_same_parent || index < _scroll_top || index >= _scroll_top + _visible_rows)
+            _scroll_top = index - _visible_rows / 2;
+        _clampScroll();
+        if (!_isViewportLoaded()) _loadWindow();
+        _relabel();
+        _focused_task = static_cast<int>(index - _scroll_top);
+        _selected_task = static_cast<int>(index - _scroll_top);
+        _prefetch();
         _task_on_selected();
     }
 
@@ -220,13 +194,20 @@ namespace components {
 
     const std::shared_ptr<std::vector<std::string>>& TaskListViewData::getTaskLabels() { return _task_labels; }
 
-    const std::shared_ptr<core::db::TaskTable>& TaskListViewData::getItems() const { return _task_items; }
+    const TaskListRow* TaskListViewData::getVisibleTask(const int row_) const
+    {
+        if (row_ < 0 || row_ >= _visible_rows) return nullptr;
+        return _taskAt(_scroll_top + row_);
+    }
 
-    bool TaskListViewData::isExistNextPage() const { return _tasks_count > per_page * _page; }
+    int TaskListViewData::getVisibleTaskCount() const
+    {
+        return static_cast<int>(std::clamp(_tasks_count - _scroll_top, 0LL, static_cast<long long>(_visible_rows)));
+    }
 
-    bool TaskListViewData::isExistPrevPage() const { return _page > 1; }
+    bool TaskListViewData::isExistNextRow() const { return _scroll_top + _visible_rows < _tasks_count; }
 
-    int TaskListViewData::getCurrentPage() const { return _page; }
+    bool TaskListViewData::isExistPrevRow() const { return _scroll_top > 0; }
 
     std::string TaskListViewData::getParentName() { return _parent_name; }
 
@@ -236,13 +217,146 @@ namespace components {
 
     void TaskListViewData::parentHistoryBack() { selectTask(_parent_id); }
 
-    std::string TaskListViewData::formattedCurrentPage() const
+    std::string TaskListViewData::formattedPosition() const
     {
+        const long long visible_count = getVisibleTaskCount();
         std::stringstream sstr;
-        sstr << std::setw(5) << std::setfill('0') << _page;
+        sstr << std::setfill('0') << std::setw(5) << (visible_count == 0 ? 0 : _scroll_top + 1) << "-"
+            << std::setw(5) << _scroll_top + visible_count << " / " << std::setw(5) << _tasks_count;
         return sstr.str();
     }
 
+    unsigned long long TaskListViewData::getRevision() const { return _revision; }
+
+    void TaskListViewData::_loadWindow()
+    {
+        const long long window_begin = std::max(0LL, _scroll_top - _visible_rows * WINDOW_MARGIN_SCREENS);
+        const long long window_rows = static_cast<long long>(_visible_rows) * (WINDOW_MARGIN_SCREENS * 2 + 1);
+        // 親タスク名・子タスクの総数・ウィンドウの行を、タスクツリーのキャッシュから取得する。
+        const auto [select_err, page] = core::db::TaskTreeCache::fetchChildTaskWindow(
+            *_task_items, _parent_id, _status_filter, window_begin, window_rows);
+        _window_begin = window_begin;
+        if (select_err != 0) {
+            _rows.clear();
+            _row_index.clear();
+            _on_error("Could not retrieve data.");
+            return;
+        }
+        _buildRows();
+        _parent_name = util::ellipsisString(page.parent_name, 55);
+        _tasks_count = page.total_count;
+    }
+
+    void TaskListViewData::_buildRows()
+    {
+        const auto& keys = _task_items->getKeys();
+        const auto& table = _task_items->getTable();
+        std::vector<TaskListRow> rows;
+        rows.reserve(keys.size());
+        std::unordered_map<long long, size_t> row_index;
+        row_index.reserve(keys.size());
+        for (const auto& key : keys) {
+            const core::db::Task& task = table.at(key);
+            TaskListRow& row = rows.emplace_back();
+            row.id = task.id;
+            row.status_id = task.status_id;
+            row.name = task.name;
+            // 前回の取得から名前が変わっていなければ、省略済みのラベルを再利用する。
+            if (const auto it = _row_index.find(task.id); it != _row_index.end() && _rows[it->second].name == task.name) {
+                row.label = std::move(_rows[it->second].label);
+                row.label_width = _rows[it->second].label_width;
+            }
+            else {
+                row.label = util::ellipsisString(task.name, 57);
+                row.label_width = util::countUtf8Character(row.label);
+            }
+            row_index.emplace(task.id, rows.size() - 1);
+        }
+        _rows = std::move(rows);
+        _row_index = std::move(row_index);
+    }
+
+    long long TaskListViewData::_indexOf(const long long task_id_) const
+    {
+        if (task_id_ <= 0) return -1;
+        const auto it = _row_index.find(task_id_);
+        if (it == _row_index.end()) return -1;
+        return _window_begin + static_cast<long long>(it->second);
+    }
+
+    bool TaskListViewData::_isViewportLoaded() const
+    {
+        const long long viewport_end = std::min(_scroll_top + _visible_rows, _tasks_count);
+        const long long window_end = _window_begin + static_cast<long long>(_rows.size());
+        return _scroll_top >= _window_begin && viewport_end <= window_end;
+    }
+
+    void TaskListViewData::_clampScroll()
+    {
+        _scroll_top = std::clamp(_scroll_top, 0LL, std::max(0LL, _tasks_count - _visible_rows));
+    }
+
+    void TaskListViewData::_clampSelection()
+    {
+        // タスクがないなら、0を常に選択する。
+        // 選択されている行にタスクがない場合は、最後のタスクを選択する。
+        if (const int task_count = getVisibleTaskCount(); _selected_task >= task_count) {
+            _selected_task = std::max(0, task_count - 1);
+            _focused_task = _selected_task;
+            _revision++;
+        }
+    }
+
+    void TaskListViewData::_relabel()
+    {
+        // 省略済みのラベルを登録する。既存の要素へ代入し、確保済みの領域を再利用する。
+        _revision++;
+        _task_labels->resize(_visible_rows);
+        for (int row = 0; row < _visible_rows; row++) {
+            if (const TaskListRow* task = getVisibleTask(row)) (*_task_labels)[row] = task->label;
+            else (*_task_labels)[row].clear();
+        }
+    }
+
+    void TaskListViewData::_applyViewport()
+    {
+        // ビューポートがウィンドウの外に出た場合のみ、切り出し直す。
+        if (!_isViewportLoaded()) _loadWindow();
+        _relabel();
+        _clampSelection();
+        _prefetch();
+    }
+
+    const TaskListRow* TaskListViewData::_taskAt(const long long index_) const
+    {
+        const long long pos = index_ - _window_begin;
+        if (pos < 0 || pos >= static_cast<long long>(_rows.size())) return nullptr;
+        return &_rows[static_cast<size_t>(pos)];
+    }
+
+    void TaskListViewData::_prefetch()
+    {
+        // 結果はタスクツリーのキャッシュに残るのみで、UIの状態は変更しない。
+        // 表示中の親タスクは、次のウィンドウの切り出しがキャッシュ済みの範囲に収まるよう、ウィンドウの2倍の余白を読み込む。
+        const long long window_rows = static_cast<long long>(_visible_rows) * (WINDOW_MARGIN_SCREENS * 2 + 1);
+        const long long margin_rows = static_cast<long long>(_visible_rows) * WINDOW_MARGIN_SCREENS * 2;
+        const long long prefetch_begin = std::max(0LL, _scroll_top - margin_rows);
+        const long long prefetch_end = _scroll_top + _visible_rows + margin_rows;
+        const long long selected_id = getSelectedTaskId();
+        // 読み込み済みの範囲であれば、キー入力ごとに読み込みを投げない。
+        if (core::db::TaskTreeCache::isWindowCovered(_parent_id, _status_filter, prefetch_begin,
+                                                     prefetch_end - prefetch_begin) &&
+            (selected_id <= 0 || core::db::TaskTreeCache::isWindowCovered(selected_id, 0, 0, window_rows)))
+            return;
+        core::db::DBWorker::post([parent_id = _parent_id, status_filter = _status_filter, prefetch_begin, prefetch_end,
+                                     selected_id, window_rows] {
+            core::db::TaskTreeCache::prefetchChildWindow(parent_id, status_filter, prefetch_begin,
+                                                         prefetch_end - prefetch_begin);
+            // taskListOnEnter()はフィルタを解除して先頭から表示するため、その範囲を読み込む。
+            if (selected_id > 0) core::db::TaskTreeCache::prefetchChildWindow(selected_id, 0, 0, window_rows);
+        });
+    }
+
     void TaskListViewData::setStatusFilter(const int i)
     {
         if (i > 4 || i <= 0) { _status_filter = 0; }
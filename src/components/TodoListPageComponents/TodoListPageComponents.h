@@ -31,8 +31,13 @@
 
 #ifndef TASKLISTVIEW_H
 #define TASKLISTVIEW_H
+#include <atomic>
+#include <optional>
+#include <unordered_map>
 #include <ftxui/component/component_base.hpp>
+#include "../../core/AsyncDB.h"
 #include "../../core/DBManager.h"
+#include "../../core/RenderCache.h"
 #include "../../utilities/DurationTimer.h"
 
 namespace core::db {
@@ -42,6 +47,26 @@ namespace core::db {
 namespace components {
     class TaskDetailBase;
 
+    /**
+     * @brief タスク一覧の1行分の表示用データです。
+     * @details 取得のたびに一度だけ作成し、描画時は参照のみを行います。
+     */
+    struct TaskListRow {
+        long long id{0};
+        long long status_id{0};
+        std::string name{};
+        // 一覧に表示する、省略済みのタスク名
+        std::string label{};
+        // labelの表示上の幅(マルチバイト文字は2、Asciiは1)
+        size_t label_width{0};
+    };
+
+    /**
+     * @brief タスク一覧の状態を保持します。
+     * @details 一覧はページに分けず、表示範囲(ビューポート)をスクロールして全ての子タスクを辿ります。
+     * 行はビューポートの前後を含む範囲(ウィンドウ)のみを保持し、ビューポートがウィンドウの外に出た時に切り出し直します。
+     * 切り出しはタスクツリーのキャッシュを通して行うため、キャッシュ済みの範囲ではデータベースを読み取りません。
+     */
     class TaskListViewData {
     public:
         explicit TaskListViewData(
@@ -49,25 +74,45 @@ namespace components {
             const std::function<void()>& task_on_selected_
         );
 
+        /**
+         * @brief 現在のスクロール位置の周辺の行を読み込み直します。
+         * @details 選択中のタスクが読み込み直した後も存在する場合は、そのタスクを選択したままにします。
+         */
         void updateTaskList();
 
         [[nodiscard]] long long getSelectedTaskId() const;
 
-        [[nodiscard]] std::string getSelectedTaskName() const;
+        [[nodiscard]] const std::string& getSelectedTaskName() const;
 
         [[nodiscard]] long long getSelectedTaskStatus() const;
 
-        [[nodiscard]] std::string getSelectedTaskDetail() const;
-
-        void resetPage();
-
-        void updatePageCount();
-
-        void nextPage();
-
-        void prevPage();
-
-        void scrollUpPrevPage();
+        /**
+         * @brief 選択中のタスクの詳細を取得します。行は詳細を保持しないため、タスクツリーのキャッシュから取得します。
+         * @details データベースは読み取りません。
+         * @return キャッシュに読み込まれていない場合や、タスクが選択されていない場合はstd::nullopt
+         */
+        [[nodiscard]] std::optional<std::string> getSelectedTaskDetail() const;
+
+        /**
+         * @brief 先頭までスクロールし、先頭の行を選択します。
+         */
+        void resetPosition();
+
+        /**
+         * @brief ビューポートの行数を設定します。端末の大きさが変わった場合に呼び出してください。
+         * @details 選択中のタスクは変わらず、ビューポートに収まるようにスクロールします。
+         * ウィンドウの切り出し直しはscrollBy()と同じ経路で行い、エラーハンドラが呼ばれる場合もあるため、描画中には呼び出さないでください。
+         * @return 行数が変わった場合はtrue
+         */
+        bool setVisibleRows(int rows_);
+
+        [[nodiscard]] int getVisibleRows() const;
+
+        /**
+         * @brief ビューポートをdelta_行だけスクロールします。選択中の行の表示上の位置は変わりません。
+         * @return スクロールした場合はtrue
+         */
+        bool scrollBy(long long delta_);
 
         void taskListOnChange();
 
@@ -83,13 +128,21 @@ namespace components {
 
         [[nodiscard]] const std::shared_ptr<std::vector<std::string>>& getTaskLabels();
 
-        [[nodiscard]] const std::shared_ptr<core::db::TaskTable>& getItems() const;
+        /**
+         * @brief ビューポートのrow_行目のタスクを取得します。
+         * @return 行にタスクがない場合はnullptr
+         * @note 描画時に呼び出されるため、メモリの確保や検索を行いません。
+         */
+        [[nodiscard]] const TaskListRow* getVisibleTask(int row_) const;
 
-        [[nodiscard]] bool isExistNextPage() const;
+        /**
+         * @brief ビューポート内でタスクがある行の数を取得します。
+         */
+        [[nodiscard]] int getVisibleTaskCount() const;
 
-        [[nodiscard]] bool isExistPrevPage() const;
+        [[nodiscard]] bool isExistNextRow() const;
 
-        [[nodiscard]] int getCurrentPage() const;
+        [[nodiscard]] bool isExistPrevRow() const;
 
         std::string getParentName();
 
@@ -99,28 +152,104 @@ namespace components {
 
         void parentHistoryBack();
 
+        /**
+         * @brief ビューポートに表示している範囲と、子タスクの総数を表す文字列を返します。
+         */
+        [[nodiscard]] std::string formattedPosition() const;
 
-        [[nodiscard]] std::string formattedCurrentPage() const;
+        /**
+         * @brief 一覧の表示内容の版を取得します。行や選択中の行が変わるたびに増加します。
+         */
+        [[nodiscard]] unsigned long long getRevision() const;
 
         void setStatusFilter(int i);
 
         static const std::vector<std::string> TASK_FILTER_MODE;
 
-        const int per_page = 20;
-
     private:
+        /**
+         * @brief ビューポートの前後を含むウィンドウを、タスクツリーのキャッシュから切り出します。
+         * @details 親タスク名と子タスクの総数も更新します。
+         */
+        void _loadWindow();
+
+        /**
+         * @brief 取得したウィンドウ(_task_items)から、表示用の行の配列を作り直します。
+         * @details 前回の取得と比較し、名前が変わっていないタスクは省略済みのラベルを再利用します。
+         */
+        void _buildRows();
+
+        /**
+         * @brief タスクがウィンドウの何行目にあるかを調べ、先頭から数えた位置を返します。
+         * @return ウィンドウにない場合は-1
+         */
+        [[nodiscard]] long long _indexOf(long long task_id_) const;
+
+        /**
+         * @brief ビューポートの全ての行がウィンドウに含まれているか判定します。
+         */
+        [[nodiscard]] bool _isViewportLoaded() const;
+
+        /**
+         * @brief スクロール位置を、子タスクの総数に収まる範囲に制限します。
+         */
+        void _clampScroll();
+
+        /**
+         * @brief 選択中の行を、タスクがある行の範囲に制限します。
+         */
+        void _clampSelection();
+
+        /**
+         * @brief ビューポートの行のラベルを更新します。
+         */
+        void _relabel();
+
+        /**
+         * @brief スクロール位置や行数の変更を反映します。ビューポートがウィンドウの外に出た場合のみ、切り出し直します。
+         */
+        void _applyViewport();
+
+        /**
+         * @brief 先頭から数えてindex_番目のタスクを取得します。
+         * @return ウィンドウの外である場合はnullptr
+         */
+        [[nodiscard]] const TaskListRow* _taskAt(long long index_) const;
+
+        /**
+         * @brief ビューポートの前後と、選択中のタスクの先頭の子タスクを、DBWorkerでタスクツリーのキャッシュに読み込みます。
+         * @details スクロールや、選択中のタスクへの移動(taskListOnEnter)をメモリ上のみで描画できるようにします。
+         * 読み込み済みの場合、ワーカースレッドでの処理はキャッシュの確認のみで終わります。
+         */
+        void _prefetch();
+
         // エラーハンドラ
         std::function<void(const std::string& msg_)> _on_error;
 
         // タスクリスト関係
         std::shared_ptr<std::vector<std::string>> _task_labels{new std::vector<std::string>};
+        // ウィンドウの取得に使用するテーブル。描画には_rowsを使用する。
         std::shared_ptr<core::db::TaskTable> _task_items{new core::db::TaskTable};
+        // ウィンドウの行。先頭は_window_begin番目のタスク
+        std::vector<TaskListRow> _rows{};
+        // タスクのidから、_rowsでの位置を引くための索引
+        std::unordered_map<long long, size_t> _row_index{};
+        // ビューポート内での位置
         int _selected_task = 0;
         int _focused_task = 0;
         long long _tasks_count = 0;
-
-        // ページ関係
-        int _page = 0;
+        // 表示内容の版
+        unsigned long long _revision{0};
+
+        // スクロール関係
+        static constexpr int DEFAULT_VISIBLE_ROWS = 20;
+        // ウィンドウが保持する、ビューポートの前後それぞれの行数(ビューポートの行数に対する倍率)
+        static constexpr int WINDOW_MARGIN_SCREENS = 1;
+        // ビューポートの先頭の行が、先頭から数えて何番目のタスクか
+        long long _scroll_top{0};
+        // ウィンドウの先頭の行が、先頭から数えて何番目のタスクか
+        long long _window_begin{0};
+        int _visible_rows{DEFAULT_VISIBLE_ROWS};
 
         // フィルタ関係
         int _status_filter{0};
@@ -148,26 +277,42 @@ namespace components {
 
         ftxui::Component TaskListMenu();
 
-        ftxui::Component PrevButton();
+        std::shared_ptr<TaskDetailBase> TaskDetail();
+
+        /**
+         * @brief 一覧をスクロールし、選択中のタスクが変わったことを詳細画面に通知します。
+         * @return スクロールした場合はtrue
+         */
+        bool _scroll(long long delta_);
 
-        ftxui::Component NextButton();
+        /**
+         * @brief 端末の高さに合わせて一覧の行数を変更し、選択中のタスクが変わった場合は詳細画面に通知します。
+         * @details 描画中に行数を変えないよう、OnRender()で変化を検出し、UIスレッドへ渡した処理から呼び出します。
+         */
+        void _resizeList();
 
-        std::shared_ptr<TaskDetailBase> TaskDetail();
+        // ページのうち、タスク一覧の行以外が占める行数(枠線・ヘッダ・フィルタ・区切り線・位置の表示)
+        static constexpr int LIST_CHROME_ROWS = 8;
+        // マウスホイール1回でスクロールする行数
+        static constexpr int WHEEL_SCROLL_ROWS = 3;
 
         TaskListViewData _data;
+        // タスク一覧の描画結果
+        core::RenderCache _task_list_cache;
 
         ftxui::Component _history_back_button;
         ftxui::Component _new_task_button;
         ftxui::Component _status_filter_toggle;
-        ftxui::Component _pagination_button;
-        ftxui::Component _prev_button;
-        ftxui::Component _next_button;
 
         ftxui::Component _task_list_menu;
         std::shared_ptr<TaskDetailBase> _task_detail;
         ftxui::Component _main_component;
 
         ftxui::Box _task_list_box;
+        // OnRender()で検出した、まだ反映していない一覧の行数。反映待ちでなければ0
+        int _pending_visible_rows{0};
+        // UIスレッドへ渡した処理の実行時に、このコンポーネントが破棄されていないか確認するためのトークン。
+        std::shared_ptr<char> _lifetime_token{std::make_shared<char>()};
     };
 
     class ActiveTaskBase final : public ftxui::ComponentBase {
@@ -182,7 +327,7 @@ namespace components {
 
         [[nodiscard]] const std::string& getActiveTaskName() const;
 
-        const std::string& getTimerText();
+        [[nodiscard]] std::string getTimerText() const;
 
         [[nodiscard]] std::chrono::seconds getSeconds() const;
 
@@ -219,11 +364,23 @@ namespace components {
 
         void selectedTaskChanged();
 
-        void updateTotalWorktime();
-
-        void updateTaskWorktime();
+        /**
+         * @brief 選択中のタスクの作業時間を、UIを停止させずに再読み込みします。読み込み中は前回の値を表示します。
+         * @details タスクの詳細(detail)がキャッシュに無い場合は、同じ読み込みで取得し、読み込み中と表示します。
+         * @details 前回の書き込み以降に読み込んだタスクであれば、即座に反映します。
+         * それ以外の場合は、短時間の連続した呼び出しをまとめ、最後の呼び出しのタスクのみを読み込みます。
+         */
+        void reloadWorktime();
 
     private:
+        core::db::AsyncTask<> _loadWorktime();
+
+        /**
+         * @brief 読み込んだタスクの詳細から、作業時間とアクティブタスクとの関係を反映します。
+         * @details タスクのdetailを読み込んでいない場合は、detailも反映します。
+         */
+        void _applyDetailSnapshot(const core::db::TaskDetailSnapshot& snapshot_);
+
         void _deleteTask();
 
         void _updateTask();
@@ -249,9 +406,22 @@ namespace components {
         int _selected_status{1};
         int _focused_status{1};
         std::string _task_detail;
+        // _task_detailに選択中のタスクの詳細を読み込み済みか。読み込み前は入力を受け付けず、更新時にも書き込まない。
+        bool _is_detail_loaded{false};
         bool _is_active_task_family{false};
         std::chrono::seconds _total_worktime{0};
         std::chrono::seconds _task_worktime{0};
+        // 作業時間の読み込みの世代。最新の読み込み以外の結果は破棄する。
+        // ワーカースレッドからも参照し、待機中に古くなった読み込みを実行しないために使用する。
+        std::shared_ptr<std::atomic<unsigned long long>> _worktime_generation{
+            std::make_shared<std::atomic<unsigned long long>>(0)
+        };
+        // 選択の変更をまとめる時間。この時間内に次の変更があれば、前の変更による読み込みは行わない。
+        static constexpr std::chrono::milliseconds WORKTIME_LOAD_DEBOUNCE{60};
+        // 作業時間、または詳細を読み込み中であればtrue
+        bool _is_loading_worktime{false};
+        // コルーチンの再開時に、このコンポーネントが破棄されていないか確認するためのトークン。
+        std::shared_ptr<char> _lifetime_token{std::make_shared<char>()};
         static const std::vector<std::string> TASK_STATUS;
     };
 
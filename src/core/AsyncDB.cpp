@@ -0,0 +1,113 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "AsyncDB.h"
+
+#include <format>
+
+#include "Logger.h"
+#include "TodoAndTimeCardApp.h"
+
+namespace core::db {
+    void DBWorker::post(std::function<void()> job_)
+    {
+        std::lock_guard lock(_mtx);
+        if (!_thread.joinable()) {
+            _loop = true;
+            _thread = std::thread(_threadProcess);
+        }
+        _jobs.emplace_back(std::move(job_));
+        _condition.notify_one();
+    }
+
+    void DBWorker::post(std::function<void()> job_, const std::chrono::milliseconds delay_)
+    {
+        if (delay_.count() <= 0) {
+            post(std::move(job_));
+            return;
+        }
+        std::lock_guard lock(_mtx);
+        if (!_thread.joinable()) {
+            _loop = true;
+            _thread = std::thread(_threadProcess);
+        }
+        _delayed_jobs.emplace(std::chrono::steady_clock::now() + delay_, std::move(job_));
+        _condition.notify_one();
+    }
+
+    void DBWorker::resumeOnUIThread(const std::coroutine_handle<> handle_)
+    {
+        TodoAndTimeCardApp::post([handle_] { handle_.resume(); });
+    }
+
+    void DBWorker::stop()
+    {
+        {
+            std::lock_guard lock(_mtx);
+            _loop = false;
+            _condition.notify_one();
+        }
+        if (_thread.joinable()) _thread.join();
+    }
+
+    void DBWorker::_threadProcess()
+    {
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock lock(_mtx);
+                while (true) {
+                    // 実行時刻になった処理を、実行待ちの末尾へ移す。終了が要求された場合は、待機中の処理も全て移す。
+                    const auto now = std::chrono::steady_clock::now();
+                    while (!_delayed_jobs.empty() && (!_loop || _delayed_jobs.begin()->first <= now)) {
+                        _jobs.emplace_back(std::move(_delayed_jobs.begin()->second));
+                        _delayed_jobs.erase(_delayed_jobs.begin());
+                    }
+                    if (!_jobs.empty() || !_loop) break;
+                    if (_delayed_jobs.empty()) _condition.wait(lock);
+                    else _condition.wait_until(lock, _delayed_jobs.begin()->first);
+                }
+                // 終了が要求されても、残っている処理は全て実行する。
+                if (_jobs.empty()) return;
+                job = std::move(_jobs.front());
+                _jobs.pop_front();
+            }
+            try { job(); }
+            catch (std::exception& e) { Logger::error(std::format("uncaught exception: {}", e.what()), "DBWorker"); }
+        }
+    }
+
+    void detail::TaskPromiseBase::reportDetachedException() const noexcept
+    {
+        if (!exception) return;
+        try { std::rethrow_exception(exception); }
+        catch (std::exception& e) { Logger::error(std::format("uncaught exception: {}", e.what()), "AsyncTask"); }
+        catch (...) { Logger::error("uncaught exception.", "AsyncTask"); }
+    }
+
+    std::thread DBWorker::_thread;
+    std::mutex DBWorker::_mtx;
+    std::condition_variable DBWorker::_condition;
+    std::deque<std::function<void()>> DBWorker::_jobs;
+    std::multimap<std::chrono::steady_clock::time_point, std::function<void()>> DBWorker::_delayed_jobs;
+    bool DBWorker::_loop{true};
+} // core::db
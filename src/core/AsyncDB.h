@@ -0,0 +1,309 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/**
+ * @file AsyncDB.h
+ * @date 26/10/16
+ * @brief UIスレッドを停止させずにデータベースへアクセスするためのコルーチン
+ * @details データベース操作は専用のワーカースレッドで実行され、co_awaitの続きはFTXUIのUIスレッドで再開されます。
+ * @author saku shirakura (saku@sakushira.com)
+ */
+
+
+#ifndef ASYNCDB_H
+#define ASYNCDB_H
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+
+namespace core::db {
+    /**
+     * @brief データベース操作を順に実行する専用のワーカースレッドです。
+     * @details 最初にpost()が呼び出された時点でスレッドを開始します。
+     */
+    class DBWorker {
+    public:
+        DBWorker() = delete;
+
+        /**
+         * @brief ワーカースレッドで実行する処理を追加します。処理は追加された順に実行されます。
+         * @param job_ 実行する処理
+         */
+        static void post(std::function<void()> job_);
+
+        /**
+         * @brief delay_が経過した後に、ワーカースレッドで実行する処理を追加します。
+         * @details 待機中は他の処理を妨げません。経過後は、その時点で追加済みの処理の後に実行されます。
+         * stop()が呼び出された場合は、経過を待たずに実行します。
+         * @param job_ 実行する処理
+         * @param delay_ 実行までの待機時間
+         */
+        static void post(std::function<void()> job_, std::chrono::milliseconds delay_);
+
+        /**
+         * @brief コルーチンをUIスレッドで再開するよう要求します。
+         * @param handle_ 再開するコルーチン
+         */
+        static void resumeOnUIThread(std::coroutine_handle<> handle_);
+
+        /**
+         * @brief 残っている処理を全て実行した後、ワーカースレッドを終了します。アプリケーションの終了時に呼び出してください。
+         */
+        static void stop();
+
+    private:
+        static void _threadProcess();
+
+        static std::thread _thread;
+        static std::mutex _mtx;
+        static std::condition_variable _condition;
+        static std::deque<std::function<void()>> _jobs;
+        // 実行時刻と、待機中の処理
+        static std::multimap<std::chrono::steady_clock::time_point, std::function<void()>> _delayed_jobs;
+        static bool _loop;
+    };
+
+    template<typename T = void>
+    class AsyncTask;
+
+    namespace detail {
+        /**
+         * @brief Taskのpromise_typeの共通部分です。
+         */
+        class TaskPromiseBase {
+        public:
+            /**
+             * @brief 終了時に、待機しているコルーチンがあれば再開します。detach()されたコルーチンは自身を破棄します。
+             */
+            struct FinalAwaiter {
+                [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+                template<typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle_) noexcept
+                {
+                    TaskPromiseBase& promise = handle_.promise();
+                    if (promise.continuation) return promise.continuation;
+                    if (promise.detached) {
+                        promise.reportDetachedException();
+                        handle_.destroy();
+                    }
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept
+                {
+                }
+            };
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+
+            FinalAwaiter final_suspend() const noexcept { return {}; }
+
+            void unhandled_exception() noexcept { exception = std::current_exception(); }
+
+            /**
+             * @brief detach()されたコルーチンで発生した例外をログに出力します。
+             */
+            void reportDetachedException() const noexcept;
+
+            std::coroutine_handle<> continuation{};
+            std::exception_ptr exception{};
+            bool detached{false};
+        };
+
+        template<typename T>
+        class TaskPromise final : public TaskPromiseBase {
+        public:
+            AsyncTask<T> get_return_object() noexcept;
+
+            template<typename U>
+            void return_value(U&& value_) { value.emplace(std::forward<U>(value_)); }
+
+            T takeResult()
+            {
+                if (exception) std::rethrow_exception(exception);
+                return std::move(*value);
+            }
+
+            std::optional<T> value{};
+        };
+
+        template<>
+        class TaskPromise<void> final : public TaskPromiseBase {
+        public:
+            AsyncTask<void> get_return_object() noexcept;
+
+            void return_void() const noexcept
+            {
+            }
+
+            void takeResult() const { if (exception) std::rethrow_exception(exception); }
+        };
+    }
+
+    /**
+     * @brief co_awaitできる遅延実行のコルーチンです。
+     * @details 他のコルーチンからco_awaitするか、UIのイベントハンドラからdetach()して開始します。
+     * @tparam T 戻り値の型
+     */
+    template<typename T>
+    class AsyncTask {
+    public:
+        using promise_type = detail::TaskPromise<T>;
+
+        explicit AsyncTask(std::coroutine_handle<promise_type> handle_) noexcept: _handle(handle_)
+        {
+        }
+
+        AsyncTask(const AsyncTask&) = delete;
+
+        AsyncTask& operator=(const AsyncTask&) = delete;
+
+        AsyncTask(AsyncTask&& other_) noexcept: _handle(std::exchange(other_._handle, {}))
+        {
+        }
+
+        AsyncTask& operator=(AsyncTask&& other_) noexcept
+        {
+            if (this != &other_) {
+                if (_handle) _handle.destroy();
+                _handle = std::exchange(other_._handle, {});
+            }
+            return *this;
+        }
+
+        ~AsyncTask() { if (_handle) _handle.destroy(); }
+
+        /**
+         * @brief 結果を待たずにコルーチンを開始します。コルーチンは終了時に自身を破棄します。
+         */
+        void detach() &&
+        {
+            auto handle = std::exchange(_handle, {});
+            handle.promise().detached = true;
+            handle.resume();
+        }
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+        std::coroutine_handle<> await_suspend(const std::coroutine_handle<> continuation_) noexcept
+        {
+            _handle.promise().continuation = continuation_;
+            return _handle;
+        }
+
+        T await_resume() { return _handle.promise().takeResult(); }
+
+    private:
+        std::coroutine_handle<promise_type> _handle;
+    };
+
+    template<typename T>
+    AsyncTask<T> detail::TaskPromise<T>::get_return_object() noexcept
+    {
+        return AsyncTask<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+    }
+
+    inline AsyncTask<void> detail::TaskPromise<void>::get_return_object() noexcept
+    {
+        return AsyncTask<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+    }
+
+    /**
+     * @brief 関数をDBWorkerで実行し、その結果を持ってUIスレッドでコルーチンを再開するAwaiterです。
+     * @tparam F 実行する関数の型
+     */
+    template<typename F>
+    class DBAwaiter {
+    public:
+        using result_type = std::invoke_result_t<F>;
+
+        explicit DBAwaiter(F function_, const std::chrono::milliseconds delay_ = std::chrono::milliseconds(0)):
+            _function(std::move(function_)),
+            _delay(delay_)
+        {
+        }
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle_)
+        {
+            DBWorker::post([this, handle_] {
+                try {
+                    if constexpr (std::is_void_v<result_type>) { _function(); }
+                    else { _result.emplace(_function()); }
+                }
+                catch (...) { _exception = std::current_exception(); }
+                DBWorker::resumeOnUIThread(handle_);
+            }, _delay);
+        }
+
+        result_type await_resume()
+        {
+            if (_exception) std::rethrow_exception(_exception);
+            if constexpr (!std::is_void_v<result_type>) { return std::move(*_result); }
+        }
+
+    private:
+        using storage_type = std::conditional_t<std::is_void_v<result_type>, bool, result_type>;
+
+        F _function;
+        std::chrono::milliseconds _delay;
+        std::optional<storage_type> _result{};
+        std::exception_ptr _exception{};
+    };
+
+    /**
+     * @brief function_をDBWorkerで実行します。`co_await runOnDBWorker(...)`の続きはUIスレッドで再開されます。
+     * @details function_はUIの状態を参照せず、必要な値はコピーでキャプチャしてください。
+     * @param function_ ワーカースレッドで実行する関数
+     * @return co_awaitすると、function_の戻り値を返すAwaiter
+     */
+    template<typename F>
+    DBAwaiter<F> runOnDBWorker(F function_) { return DBAwaiter<F>(std::move(function_)); }
+
+    /**
+     * @brief delay_が経過した後に、function_をDBWorkerで実行します。
+     * @details 短時間に繰り返し要求される読み込みをまとめるために使用します。
+     * function_の実行時に、待機中により新しい要求があったか確認し、古い要求であれば読み込まずに終了してください。
+     * @param delay_ 実行までの待機時間
+     * @param function_ ワーカースレッドで実行する関数
+     * @return co_awaitすると、function_の戻り値を返すAwaiter
+     */
+    template<typename F>
+    DBAwaiter<F> runOnDBWorkerAfter(const std::chrono::milliseconds delay_, F function_)
+    {
+        return DBAwaiter<F>(std::move(function_), delay_);
+    }
+} // core::db
+
+#endif //ASYNCDB_H
@@ -22,6 +22,8 @@
 
 #include "DBManager.h"
 
+#include <algorithm>
+#include <cctype>
 #include <complex>
 #include <format>
 #include <fstream>
@@ -32,9 +34,15 @@
 #include <vector>
 #include <memory>
 #include <regex>
+#include <tuple>
 
 #include "DBMigrator.h"
+#include "DBPerformanceProfile.h"
 #include "Logger.h"
+#include "QueryPlanAuditor.h"
+#include "QueryStats.h"
+#include "SettingsStore.h"
+#include "TaskTreeCache.h"
 #include "../resource.h"
 
 #include "../utilities/Utilities.h"
@@ -76,6 +84,288 @@ namespace core::db {
         return default_value_;
     }
 
+    int bindValues(sqlite3_stmt* stmt_, const std::vector<ColValue>& values_)
+    {
+        int binder_err = 0;
+        for (int i = 0; i < values_.size(); i++) {
+            const int placeholder_i = i + 1;
+            switch (const auto& [column_type, value] = values_.at(i); column_type) {
+            case ColType::T_REAL:
+                binder_err = sqlite3_bind_double(stmt_, placeholder_i, std::get<double>(value));
+                break;
+            case ColType::T_INTEGER:
+                binder_err = sqlite3_bind_int64(stmt_, placeholder_i, std::get<long long>(value));
+                break;
+            case ColType::T_TEXT:
+                binder_err = sqlite3_bind_text(stmt_, placeholder_i, std::get<std::string>(value).c_str(), -1,
+                                               SQLITE_TRANSIENT);
+                break;
+            case ColType::T_NULL:
+                binder_err = sqlite3_bind_null(stmt_, placeholder_i);
+                break;
+            }
+            if (binder_err != SQLITE_OK) {
+                return DBManager::getPrefixedErrorCode(binder_err, DBManager::ErrorPrefix::BIND_ERROR);
+            }
+        }
+        return SQLITE_OK;
+    }
+
+    void ResultSet::clear()
+    {
+        _column_names.clear();
+        _cells.clear();
+        _text_buffer.clear();
+    }
+
+    void ResultSet::setColumns(sqlite3_stmt* stmt_)
+    {
+        clear();
+        const int col_count = sqlite3_column_count(stmt_);
+        _column_names.reserve(col_count);
+        for (int col = 0; col < col_count; col++) { _column_names.emplace_back(sqlite3_column_name(stmt_, col)); }
+    }
+
+    void ResultSet::appendRow(sqlite3_stmt* stmt_)
+    {
+        const int col_count = static_cast<int>(_column_names.size());
+        // それぞれの列を適切な型でCellに格納する。
+        for (int col = 0; col < col_count; col++) {
+            Cell& cell = _cells.emplace_back();
+            switch (sqlite3_column_type(stmt_, col)) {
+            case SQLITE_FLOAT:
+                cell.type = ColType::T_REAL;
+                cell.real = sqlite3_column_double(stmt_, col);
+                break;
+            case SQLITE_INTEGER:
+                cell.type = ColType::T_INTEGER;
+                cell.integer = sqlite3_column_int64(stmt_, col);
+                break;
+            case SQLITE_TEXT:
+                {
+                    cell.type = ColType::T_TEXT;
+                    // 戻り値がconst unsigned char*なので、const char*に変換する。
+                    const auto text = reinterpret_cast<const char*>(sqlite3_column_text(stmt_, col));
+                    const int text_size = sqlite3_column_bytes(stmt_, col);
+                    cell.text = {_text_buffer.size(), static_cast<size_t>(text_size)};
+                    _text_buffer.append(text, text_size);
+                    break;
+                }
+            case SQLITE_NULL:
+            default:
+                cell.type = ColType::T_NULL;
+                cell.integer = 0;
+                break;
+            }
+        }
+    }
+
+    bool ResultSet::empty() const { return _cells.empty(); }
+
+    size_t ResultSet::rowCount() const
+    {
+        if (_column_names.empty()) return 0;
+        return _cells.size() / _column_names.size();
+    }
+
+    size_t ResultSet::columnCount() const { return _column_names.size(); }
+
+    const std::vector<std::string>& ResultSet::getColumnNames() const { return _column_names; }
+
+    int ResultSet::columnIndex(const std::string_view column_name_) const
+    {
+        for (size_t col = 0; col < _column_names.size(); col++) {
+            if (_column_names.at(col) == column_name_) return static_cast<int>(col);
+        }
+        return -1;
+    }
+
+    ColType ResultSet::getType(const size_t row_, const int col_) const
+    {
+        const Cell* cell = _cell(row_, col_);
+        return cell == nullptr ? ColType::T_NULL : cell->type;
+    }
+
+    double ResultSet::getDouble(const size_t row_, const int col_, const double default_value_) const
+    {
+        const Cell* cell = _cell(row_, col_);
+        if (cell != nullptr && cell->type == ColType::T_REAL) return cell->real;
+        return default_value_;
+    }
+
+    long long ResultSet::getLongLong(const size_t row_, const int col_, const long long default_value_) const
+    {
+        const Cell* cell = _cell(row_, col_);
+        if (cell != nullptr && cell->type == ColType::T_INTEGER) return cell->integer;
+        return default_value_;
+    }
+
+    std::string_view ResultSet::getStringView(const size_t row_, const int col_,
+                                              const std::string_view default_value_) const
+    {
+        const Cell* cell = _cell(row_, col_);
+        if (cell != nullptr && cell->type == ColType::T_TEXT) {
+            return std::string_view(_text_buffer).substr(cell->text.offset, cell->text.length);
+        }
+        return default_value_;
+    }
+
+    std::string ResultSet::getString(const size_t row_, const int col_, const std::string& default_value_) const
+    {
+        const Cell* cell = _cell(row_, col_);
+        if (cell != nullptr && cell->type == ColType::T_TEXT) {
+            return _text_buffer.substr(cell->text.offset, cell->text.length);
+        }
+        return default_value_;
+    }
+
+    ColValue ResultSet::getValue(const size_t row_, const int col_) const
+    {
+        switch (getType(row_, col_)) {
+        case ColType::T_REAL:
+            return {ColType::T_REAL, getDouble(row_, col_)};
+        case ColType::T_INTEGER:
+            return {ColType::T_INTEGER, getLongLong(row_, col_)};
+        case ColType::T_TEXT:
+            return {ColType::T_TEXT, getString(row_, col_)};
+        case ColType::T_NULL:
+        default:
+            return {ColType::T_NULL, nullptr};
+        }
+    }
+
+    const ResultSet::Cell* ResultSet::_cell(const size_t row_, const int col_) const
+    {
+        if (col_ < 0 || col_ >= static_cast<int>(_column_names.size())) return nullptr;
+        const size_t index = row_ * _column_names.size() + col_;
+        if (index >= _cells.size()) return nullptr;
+        return &_cells.at(index);
+    }
+
+    StatementCache::StatementCache(const size_t capacity_): _capacity(capacity_)
+    {
+    }
+
+    sqlite3_stmt* StatementCache::find(const std::string& sql_, std::string& sql_remaining_)
+    {
+        const auto found = _index.find(sql_);
+        if (found == _index.end()) return nullptr;
+        // 最も最近使用されたステートメントとして先頭に移動する。
+        _entries.splice(_entries.begin(), _entries, found->second);
+        sql_remaining_ = found->second->sql_remaining;
+        return found->second->stmt.get();
+    }
+
+    sqlite3_stmt* StatementCache::insert(const std::string& sql_, sqlite3_stmt* stmt_,
+                                         const std::string& sql_remaining_)
+    {
+        // 容量を超える場合は、最も長く使用されていないステートメントを破棄する。
+        while (!_entries.empty() && _entries.size() >= _capacity) {
+            _index.erase(_entries.back().sql);
+            _entries.pop_back();
+        }
+        _entries.emplace_front(
+            sql_,
+            std::unique_ptr<sqlite3_stmt, sqliteDeleter::StatementFinalizer>(
+                stmt_, sqliteDeleter::StatementFinalizer()),
+            sql_remaining_);
+        // キーはリスト内の文字列を参照するため、要素が破棄されるまで有効。
+        _index.insert_or_assign(_entries.front().sql, _entries.begin());
+        return stmt_;
+    }
+
+    void StatementCache::clear()
+    {
+        _index.clear();
+        _entries.clear();
+    }
+
+    size_t StatementCache::size() const { return _entries.size(); }
+
+    bool StatementCache::isAuditPassed(const sqlite3_stmt* stmt_) const
+    {
+        // find()とinsert()は対象を先頭に置くため、先頭のみを確認すればよい。
+        return !_entries.empty() && _entries.front().stmt.get() == stmt_ && _entries.front().audit_passed;
+    }
+
+    void StatementCache::markAuditPassed(const sqlite3_stmt* stmt_)
+    {
+        if (!_entries.empty() && _entries.front().stmt.get() == stmt_) _entries.front().audit_passed = true;
+    }
+
+    ReadConnection::~ReadConnection() { close(); }
+
+    int ReadConnection::open(const std::string& db_file_, const unsigned long long generation_)
+    {
+        close();
+        sqlite3* tmp_db;
+        // 作成したスレッドからのみ使用するため、sqlite側のミューテックスは不要。
+        if (const int open_db_err = sqlite3_open_v2(db_file_.c_str(), &tmp_db,
+                                                    SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX, nullptr);
+            open_db_err != SQLITE_OK) {
+            sqliteDeleter::DatabaseCloser()(tmp_db);
+            return DBManager::getPrefixedErrorCode(open_db_err, DBManager::ErrorPrefix::OPEN_DB_ERROR);
+        }
+        _db.reset(tmp_db);
+        _generation = generation_;
+        return 0;
+    }
+
+    void ReadConnection::close()
+    {
+        // ステートメントは接続を閉じる前に破棄する。
+        _statement_cache.clear();
+        _db = nullptr;
+    }
+
+    bool ReadConnection::isOpen() const { return _db != nullptr; }
+
+    unsigned long long ReadConnection::getGeneration() const { return _generation; }
+
+    sqlite3* ReadConnection::get() const { return _db.get(); }
+
+    StatementCache& ReadConnection::getStatementCache() { return _statement_cache; }
+
+    namespace {
+        /**
+         * @brief スレッドごとの読み取り接続の状態です。
+         */
+        struct ThreadReadState {
+            ReadConnection connection;
+            // ReadScopeの入れ子の深さ
+            int scope_depth{0};
+            // 読み取りトランザクションが開始されていればtrue
+            bool is_active{false};
+            // transaction()の入れ子の深さ
+            int transaction_depth{0};
+        };
+
+        thread_local ThreadReadState thread_read_state;
+
+        // 実行中の公開関数の呼び出し元 (QueryPlanAuditorの報告に使用する)
+        thread_local const std::source_location* current_call_site = nullptr;
+
+        /**
+         * @brief スコープの間、current_call_siteを設定します。入れ子の場合は、最も外側の呼び出し元を維持します。
+         */
+        class CallSiteScope final {
+        public:
+            explicit CallSiteScope(const std::source_location& location_): _prev(current_call_site)
+            {
+                if (_prev == nullptr) current_call_site = &location_;
+            }
+
+            CallSiteScope(const CallSiteScope&) = delete;
+
+            CallSiteScope& operator=(const CallSiteScope&) = delete;
+
+            ~CallSiteScope() { current_call_site = _prev; }
+
+        private:
+            const std::source_location* _prev;
+        };
+    }
+
     bool DBManager::setDBFile(const std::string& file_path_)
     {
         std::error_code ec;
@@ -116,6 +406,8 @@ namespace core::db {
             if (const int initialize_err = _manager->_initializeDB(); initialize_err != 0) { return initialize_err; }
         }
         DBMigrator::migrate();
+        // PRAGMAの設定値はsettingsテーブルに保存されているため、マイグレーションの後に適用する。
+        DBPerformanceProfile::apply();
         return 0;
     }
 
@@ -126,15 +418,40 @@ namespace core::db {
     }
 
 
-    int DBManager::usePlaceholderUniSql(const std::string& sql_, Table& result_table_,
+    int DBManager::usePlaceholderUniSql(const std::string& sql_, ResultSet& result_table_,
                                         int (*binder_)(void*, sqlite3_stmt*), void* binder_arg_,
-                                        std::string& sql_remaining_)
+                                        std::string& sql_remaining_, const std::source_location& location_)
     {
         // db接続を開く(既に開かれている場合は何も実行されない)
         if (const int open_db_err = openDB(); open_db_err != 0) { return open_db_err; }
+        const CallSiteScope call_site(location_);
+        // ReadScopeの内部であれば、書き込み用の接続をロックせずに読み取り接続で実行する。
+        if (ReadConnection* reader = _activeReadConnection(); reader != nullptr) {
+            if (const int err = _manager->_usePlaceholderUniSqlInternal(sql_, result_table_, binder_, binder_arg_,
+                                                                        sql_remaining_, true, reader);
+                getErrorPos(err) != ErrorPrefix::NOT_READ_ONLY) { return err; }
+        }
         return _manager->_usePlaceholderUniSql(sql_, result_table_, binder_, binder_arg_, sql_remaining_);
     }
 
+    int DBManager::forEachRow(const std::string& sql_, int (*binder_)(void*, sqlite3_stmt*), void* binder_arg_,
+                              const RowCallback& on_row_, const size_t max_rows_,
+                              const std::source_location& location_)
+    {
+        // db接続を開く(既に開かれている場合は何も実行されない)
+        if (const int open_db_err = openDB(); open_db_err != 0) { return open_db_err; }
+        const CallSiteScope call_site(location_);
+        std::string unused_string;
+        if (ReadConnection* reader = _activeReadConnection(); reader != nullptr) {
+            if (const int err = _manager->_stepStatementInternal(sql_, binder_, binder_arg_, unused_string, true,
+                                                                 nullptr, on_row_, max_rows_, reader);
+                getErrorPos(err) != ErrorPrefix::NOT_READ_ONLY) { return err; }
+        }
+        std::lock_guard lock(_manager->_interface_mtx);
+        return _manager->_stepStatementInternal(sql_, binder_, binder_arg_, unused_string, true, nullptr, on_row_,
+                                                max_rows_);
+    }
+
     constexpr int prefix_base = 100000;
 
     int DBManager::getErrorCode(const int error_code_) { return error_code_ % prefix_base; }
@@ -159,6 +476,13 @@ namespace core::db {
         return remove_err.value();
     }
 
+    void DBManager::clearStatementCache()
+    {
+        if (_manager == nullptr) return;
+        std::scoped_lock lock{_manager->_interface_mtx, _manager->_internal_mtx};
+        _manager->_statement_cache.clear();
+    }
+
     bool DBManager::_isValidErrorPos(const int error_pref_)
     {
         return error_pref_ < static_cast<int>(ErrorPrefix::LAST_ENUM) && error_pref_ >= 0;
@@ -167,23 +491,28 @@ namespace core::db {
     int DBManager::_execute(const std::string& sql_)
     {
         std::lock_guard lock(this->_interface_mtx);
-        Table tbl;
+        ResultSet tbl;
         // 残りのsql文
         std::string current_sql = sql_;
+        // 複数文からなるsqlはスキーマを変更することが多いため、キャッシュを使用せずに実行し、終了後にキャッシュを破棄する。
+        int result = 0;
         // sql文を全て実行する。
         while (!current_sql.empty()) {
-            if (const int err = this->_usePlaceholderUniSqlInternal(current_sql, tbl, nullptr, nullptr, current_sql);
+            if (const int err = this->_usePlaceholderUniSqlInternal(current_sql, tbl, nullptr, nullptr, current_sql,
+                                                                    false);
                 err != 0) {
                 // 最後の文に到達した場合は処理を終了する。
-                if (getErrorPos(err) == ErrorPrefix::END_OF_STATEMENT)
-                    break;
-                return err;
+                if (getErrorPos(err) != ErrorPrefix::END_OF_STATEMENT)
+                    result = err;
+                break;
             }
         }
-        return 0;
+        std::lock_guard internal_lock(this->_internal_mtx);
+        _statement_cache.clear();
+        return result;
     }
 
-    int DBManager::_usePlaceholderUniSql(const std::string& sql_, Table& result_table_,
+    int DBManager::_usePlaceholderUniSql(const std::string& sql_, ResultSet& result_table_,
                                          int (*binder_)(void*, sqlite3_stmt*), void* binder_arg_,
                                          std::string& sql_remaining_)
     {
@@ -191,102 +520,273 @@ namespace core::db {
         return _usePlaceholderUniSqlInternal(sql_, result_table_, binder_, binder_arg_, sql_remaining_);
     }
 
+    namespace {
+        /**
+         * @brief スコープを抜ける際に、ステートメントを再利用可能な状態に戻します。
+         */
+        class StatementResetter final {
+        public:
+            explicit StatementResetter(sqlite3_stmt* stmt_): _stmt(stmt_)
+            {
+            }
+
+            StatementResetter(const StatementResetter&) = delete;
+
+            StatementResetter& operator=(const StatementResetter&) = delete;
+
+            ~StatementResetter()
+            {
+                sqlite3_reset(_stmt);
+                sqlite3_clear_bindings(_stmt);
+            }
+
+        private:
+            sqlite3_stmt* _stmt;
+        };
+    }
+
+    int DBManager::_usePlaceholderUniSqlInternal(const std::string& sql_, ResultSet& result_table_,
+                                                 int (*binder_)(void*, sqlite3_stmt*), void* binder_arg_,
+                                                 std::string& sql_remaining_, const bool use_cache_,
+                                                 ReadConnection* reader_)
+    {
+        return _stepStatementInternal(sql_, binder_, binder_arg_, sql_remaining_, use_cache_,
+                                      // エラーが発生しておらず、select文であれば、データをクリアし列情報を設定する。
+                                      [&result_table_](sqlite3_stmt* stmt_) { result_table_.setColumns(stmt_); },
+                                      // 取得した行をResultSetに格納する。
+                                      [&result_table_](sqlite3_stmt* stmt_) {
+                                          result_table_.appendRow(stmt_);
+                                          return true;
+                                      }, 0, reader_);
+    }
+
     // ReSharper disable once CppPassValueParameterByConstReference
-    int DBManager::_usePlaceholderUniSqlInternal(std::string sql_ /* c_str()による未定義動作を回避するためにコピー */, Table& result_table_, int (*binder_)(void*, sqlite3_stmt*), // NOLINT(performance-unnecessary-value-param)
-                                                 void* binder_arg_, std::string& sql_remaining_)
+    int DBManager::_stepStatementInternal(std::string sql_ /* c_str()による未定義動作を回避するためにコピー */, // NOLINT(performance-unnecessary-value-param)
+                                          int (*binder_)(void*, sqlite3_stmt*), void* binder_arg_,
+                                          std::string& sql_remaining_, const bool use_cache_,
+                                          const std::function<void(sqlite3_stmt*)>& on_columns_,
+                                          const RowCallback& on_row_, const size_t max_rows_,
+                                          ReadConnection* reader_)
     {
-        std::lock_guard lock(this->_internal_mtx);
-        if (_db == nullptr) { return getPrefixedErrorCode(0, ErrorPrefix::DB_NOT_OPEN); }
-        sqlite3_stmt* tmp_stmt;
-        const char* tmp;
-        // sqlを準備する。
-        if (const int prepare_err = sqlite3_prepare_v2(this->_db.get(), sql_.c_str(), -1,
-                                                       &tmp_stmt, &tmp);
-            prepare_err != SQLITE_OK) { return getPrefixedErrorCode(prepare_err, ErrorPrefix::PREPARE_SQL_ERROR); }
-        // sqlが準備できなかった場合には終了する。(正常終了)
-        if (tmp_stmt == nullptr) { return getPrefixedErrorCode(0, ErrorPrefix::END_OF_STATEMENT); }
-        sql_remaining_ = std::string(tmp);
-        const std::unique_ptr<sqlite3_stmt, sqliteDeleter::StatementFinalizer> stmt(
-            tmp_stmt, sqliteDeleter::StatementFinalizer());
+        // 読み取り接続はスレッド専用のため、ロックしない。
+        std::unique_lock lock(this->_internal_mtx, std::defer_lock);
+        if (reader_ == nullptr) lock.lock();
+        sqlite3* db = reader_ == nullptr ? _db.get() : reader_->get();
+        // キャッシュされていないステートメントの所有者
+        std::unique_ptr<sqlite3_stmt, sqliteDeleter::StatementFinalizer> uncached_stmt(
+            nullptr, sqliteDeleter::StatementFinalizer());
+        sqlite3_stmt* stmt = nullptr;
+        if (const int prepare_err = _prepareStatementInternal(sql_, sql_remaining_, use_cache_, uncached_stmt, stmt,
+                                                              reader_);
+            prepare_err != 0) { return prepare_err; }
+        // 読み取り接続で書き込みを行う文は、実行せずに呼び出し元へ返す。
+        if (reader_ != nullptr && !sqlite3_stmt_readonly(stmt)) {
+            return getPrefixedErrorCode(0, ErrorPrefix::NOT_READ_ONLY);
+        }
+        // 初期化やマイグレーションのように、キャッシュを使用しない一度きりの文は監査しない。
+        // 監査を通過済みの文は、キャッシュの印によりロックを取らずに省略する。
+        if (use_cache_ && QueryPlanAuditor::isEnabled()) {
+            StatementCache& cache = reader_ == nullptr ? _statement_cache : reader_->getStatementCache();
+            if (!cache.isAuditPassed(stmt) && QueryPlanAuditor::inspect(db, stmt, current_call_site)) {
+                cache.markAuditPassed(stmt);
+            }
+        }
+        const StatementResetter resetter(stmt);
+        // スキーマが変更された場合、キャッシュ済みのステートメントは破棄する。
+        const bool clear_cache_after_step = use_cache_ && uncached_stmt != nullptr;
         if (binder_ != nullptr) {
             // placeholderと値を紐づける。
-            if (const int binder_err = binder_(binder_arg_, stmt.get()); binder_err != SQLITE_OK) { return binder_err; }
+            if (const int binder_err = binder_(binder_arg_, stmt); binder_err != SQLITE_OK) { return binder_err; }
         }
-        const auto tmp_query_str_c_style = sqlite3ExpandedSqlWrapper(stmt.get());
-        const std::string current_query_string = tmp_query_str_c_style.get();
-        const auto start_query_at = std::chrono::high_resolution_clock::now();
-        const int before_changes = sqlite3_total_changes(_db.get());
+        // クエリログと統計が不要な場合は、時刻の取得やsqlの展開を行わない。
+        const bool log_query = _isQueryLogTarget();
+        const auto start_query_at = log_query || _slow_query_threshold_ms.load(std::memory_order_relaxed) > 0 ||
+                                    QueryStats::isEnabled()
+                                        ? std::chrono::high_resolution_clock::now()
+                                        : std::chrono::high_resolution_clock::time_point{};
+        const int before_changes = sqlite3_total_changes(db);
         // sqlを実行
-        int step_status = sqlite3_step(stmt.get());
-        // エラーが発生しておらず、select文であれば、データをクリアする。
-        if (sqlite3_stmt_readonly(stmt.get()) && (step_status == SQLITE_ROW || step_status == SQLITE_DONE)) {
-            result_table_.clear();
-        }
+        int step_status = sqlite3_step(stmt);
+        // エラーが発生しておらず、select文であれば、列情報を通知する。
+        if (on_columns_ != nullptr && sqlite3_stmt_readonly(stmt) &&
+            (step_status == SQLITE_ROW || step_status == SQLITE_DONE)) { on_columns_(stmt); }
         if (step_status != SQLITE_ROW) {
             if (step_status != SQLITE_DONE) {
-                _queryLogger(start_query_at, current_query_string, false, false, 0);
+                _queryLogger(stmt, start_query_at, log_query, false, false, 0);
                 return getPrefixedErrorCode(step_status, ErrorPrefix::STEP_ERROR);
             }
-            const int after_changes = sqlite3_total_changes(_db.get());
-            _queryLogger(start_query_at, current_query_string, true, false, after_changes - before_changes);
+            const int after_changes = sqlite3_total_changes(db);
+            _queryLogger(stmt, start_query_at, log_query, true, false, after_changes - before_changes);
+            if (clear_cache_after_step) _statement_cache.clear();
             return SQLITE_OK;
         }
-        // 取得した行をTableに格納する。
+        // 取得した行をon_row_に渡す。
+        size_t rows_count = 0;
         while (step_status == SQLITE_ROW) {
-            const int col_count = sqlite3_column_count(stmt.get());
-            RowHash current_row;
-            // それぞれの列を適切な型でRowHashに格納する。
-            for (int col = 0; col < col_count; col++) {
-                const int col_type = sqlite3_column_type(stmt.get(), col);
-                ColValue col_val;
-                switch (col_type) {
-                case 2:
-                    col_val.first = ColType::T_REAL;
-                    col_val.second = sqlite3_column_double(stmt.get(), col);
-                    break;
-                case 1:
-                    col_val.first = ColType::T_INTEGER;
-                    col_val.second = sqlite3_column_int64(stmt.get(), col);
-                    break;
-                case 3:
-                    {
-                        col_val.first = ColType::T_TEXT;
-                        // 戻り値がconst unsigned char*なので、const char*に変換する。
-                        const auto text = reinterpret_cast<const char*>(sqlite3_column_text(stmt.get(), col));
-                        const int text_size = sqlite3_column_bytes(stmt.get(), col);
-                        col_val.second = std::string(text, text_size);
-                        break;
-                    }
-                case 5:
-                default:
-                    col_val.first = ColType::T_NULL;
-                    col_val.second = nullptr;
-                    break;
-                }
-                const std::string column_name = sqlite3_column_name(stmt.get(), col);
-                current_row.try_emplace(column_name, col_val);
+            // 上限を超える行が存在する場合は、残りを読み取らずに終了する。
+            if (max_rows_ != 0 && rows_count >= max_rows_) {
+                _queryLogger(stmt, start_query_at, log_query, true, true, rows_count);
+                return getPrefixedErrorCode(0, ErrorPrefix::ROW_LIMIT_REACHED);
             }
-            // TableにRowHashを追加。
-            result_table_.emplace_back(std::move(current_row));
+            rows_count++;
+            // コールバックが中断を要求した場合は、正常終了とする。
+            if (!on_row_(stmt)) break;
             // sqlを実行
-            step_status = sqlite3_step(stmt.get());
+            step_status = sqlite3_step(stmt);
+        }
+        if (step_status != SQLITE_ROW && step_status != SQLITE_DONE) {
+            _queryLogger(stmt, start_query_at, log_query, false, true, rows_count);
+            return getPrefixedErrorCode(step_status, ErrorPrefix::STEP_ERROR);
         }
 
-        _queryLogger(start_query_at, current_query_string, true, true, result_table_.size());
+        _queryLogger(stmt, start_query_at, log_query, true, true, rows_count);
         return SQLITE_OK;
     }
 
+    int DBManager::_prepareStatementInternal(const std::string& sql_, std::string& sql_remaining_,
+                                             const bool use_cache_,
+                                             std::unique_ptr<sqlite3_stmt, sqliteDeleter::StatementFinalizer>&
+                                             uncached_stmt_, sqlite3_stmt*& stmt_, ReadConnection* reader_)
+    {
+        sqlite3* db = reader_ == nullptr ? _db.get() : reader_->get();
+        StatementCache& statement_cache = reader_ == nullptr ? _statement_cache : reader_->getStatementCache();
+        if (db == nullptr) { return getPrefixedErrorCode(0, ErrorPrefix::DB_NOT_OPEN); }
+        stmt_ = use_cache_ ? statement_cache.find(sql_, sql_remaining_) : nullptr;
+        if (stmt_ != nullptr) return 0;
+        sqlite3_stmt* tmp_stmt;
+        const char* tmp;
+        // sqlを準備する。
+        if (const int prepare_err = sqlite3_prepare_v2(db, sql_.c_str(), -1,
+                                                       &tmp_stmt, &tmp);
+            prepare_err != SQLITE_OK) { return getPrefixedErrorCode(prepare_err, ErrorPrefix::PREPARE_SQL_ERROR); }
+        // sqlが準備できなかった場合には終了する。(正常終了)
+        if (tmp_stmt == nullptr) { return getPrefixedErrorCode(0, ErrorPrefix::END_OF_STATEMENT); }
+        sql_remaining_ = std::string(tmp);
+        // スキーマを変更するsqlはキャッシュしない。
+        if (use_cache_ && !_isSchemaStatement(tmp_stmt)) {
+            stmt_ = statement_cache.insert(sql_, tmp_stmt, sql_remaining_);
+        }
+        else {
+            uncached_stmt_.reset(tmp_stmt);
+            stmt_ = tmp_stmt;
+        }
+        return 0;
+    }
+
+    int DBManager::transaction(const std::function<int()>& fn_)
+    {
+        if (const int open_db_err = openDB(); open_db_err != 0) { return open_db_err; }
+        // 他のスレッドの文がトランザクションに混入しないよう、トランザクションの終了まで_interface_mtxを保持する。
+        std::lock_guard lock(_manager->_interface_mtx);
+        DBManager& manager = *_manager;
+        // 最も外側ではBEGIN、入れ子の場合はSAVEPOINTを使用する。
+        const std::string savepoint = std::format("sp_{}", manager._transaction_depth);
+        const bool is_outermost = manager._transaction_depth == 0;
+        if (const int begin_err = manager._executeControlInternal(
+                is_outermost ? "BEGIN IMMEDIATE;" : std::format("SAVEPOINT {};", savepoint));
+            begin_err != 0) { return begin_err; }
+        manager._transaction_depth++;
+        // トランザクション内の読み取りは、書き込み中の内容を参照できるよう書き込み用の接続で行う。
+        thread_read_state.transaction_depth++;
+        const auto rollback = [&] {
+            manager._transaction_depth--;
+            thread_read_state.transaction_depth--;
+            if (is_outermost) manager._executeControlInternal("ROLLBACK;");
+            else {
+                manager._executeControlInternal(std::format("ROLLBACK TO {};", savepoint));
+                manager._executeControlInternal(std::format("RELEASE {};", savepoint));
+            }
+        };
+        int fn_err = 0;
+        try { fn_err = fn_(); }
+        catch (...) {
+            rollback();
+            throw;
+        }
+        if (fn_err != 0) {
+            rollback();
+            return fn_err;
+        }
+        manager._transaction_depth--;
+        thread_read_state.transaction_depth--;
+        if (const int commit_err = manager._executeControlInternal(
+                is_outermost ? "COMMIT;" : std::format("RELEASE {};", savepoint));
+            commit_err != 0) {
+            // COMMITに失敗した場合は、トランザクションが残らないようにロールバックする。
+            if (is_outermost) manager._executeControlInternal("ROLLBACK;");
+            return commit_err;
+        }
+        return 0;
+    }
+
+    int DBManager::executeBatch(const std::string& sql_, const std::vector<std::vector<ColValue>>& parameter_sets_)
+    {
+        if (parameter_sets_.empty()) return 0;
+        return transaction([&sql_, &parameter_sets_] {
+            DBManager& manager = *_manager;
+            std::lock_guard lock(manager._internal_mtx);
+            std::unique_ptr<sqlite3_stmt, sqliteDeleter::StatementFinalizer> uncached_stmt(
+                nullptr, sqliteDeleter::StatementFinalizer());
+            sqlite3_stmt* stmt = nullptr;
+            std::string unused_string;
+            if (const int prepare_err = manager._prepareStatementInternal(
+                    sql_, unused_string, true, uncached_stmt, stmt);
+                prepare_err != 0) { return prepare_err; }
+            const StatementResetter resetter(stmt);
+            const bool log_batch = Logger::isQueryLogEnabled(Logger::LogLevel::DEBUG);
+            const auto start_batch_at = log_batch || QueryStats::isEnabled()
+                                            ? std::chrono::high_resolution_clock::now()
+                                            : std::chrono::high_resolution_clock::time_point{};
+            const int before_changes = sqlite3_total_changes(manager._db.get());
+            // 同じステートメントを、値のみ差し替えて繰り返し実行する。
+            for (const auto& parameter_set : parameter_sets_) {
+                sqlite3_reset(stmt);
+                sqlite3_clear_bindings(stmt);
+                if (const int binder_err = bindValues(stmt, parameter_set); binder_err != SQLITE_OK) {
+                    return binder_err;
+                }
+                if (const int step_status = sqlite3_step(stmt); step_status != SQLITE_DONE && step_status != SQLITE_ROW) {
+                    return getPrefixedErrorCode(step_status, ErrorPrefix::STEP_ERROR);
+                }
+            }
+            // バッチ全体を1回の実行として統計に記録する。
+            QueryStats::record(stmt, std::chrono::high_resolution_clock::now() - start_batch_at, true, 0,
+                               sqlite3_total_changes(manager._db.get()) - before_changes);
+            if (log_batch) {
+                Logger::debug(std::format("batch:\n{}\n({} ms) {} parameter sets - Affected {} rows - ok.",
+                                          sql_,
+                                          std::chrono::duration<double, std::milli>(
+                                              std::chrono::high_resolution_clock::now() - start_batch_at).count(),
+                                          parameter_sets_.size(),
+                                          sqlite3_total_changes(manager._db.get()) - before_changes),
+                              "DBManager");
+            }
+            return 0;
+        });
+    }
+
+    int DBManager::_executeControlInternal(const std::string& sql_)
+    {
+        ResultSet unused_table;
+        std::string unused_string;
+        return _usePlaceholderUniSqlInternal(sql_, unused_table, nullptr, nullptr, unused_string);
+    }
+
     int DBManager::_openDB(const std::string& db_file_)
     {
         if (this->_db == nullptr) {
             sqlite3* tmp_db;
-            if (const int open_db_err = sqlite3_open(db_file_.c_str(), &tmp_db); open_db_err != SQLITE_OK) {
+            if (const int open_db_err = sqlite3_open_v2(db_file_.c_str(), &tmp_db,
+                                                        SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr);
+                open_db_err != SQLITE_OK) {
                 sqliteDeleter::DatabaseCloser()(tmp_db);
                 return getPrefixedErrorCode(open_db_err, ErrorPrefix::OPEN_DB_ERROR);
             }
             this->_db.reset(tmp_db);
             if (const int execute_err = _execute(std::string(F_OPEN_DB_PREPROC_SQL, SIZE_OPEN_DB_PREPROC_SQL));
                 execute_err != SQLITE_OK) { return getPrefixedErrorCode(execute_err, ErrorPrefix::EXECUTE_ERROR); }
+            // 書き込みはこの接続のみで行われるため、この接続の変更を検出すればタスクツリーのキャッシュを最新に保てる。
+            TaskTreeCache::attach(this->_db.get());
         }
         return SQLITE_OK;
     }
@@ -294,7 +794,61 @@ namespace core::db {
     void DBManager::_closeDB()
     {
         std::scoped_lock lock{this->_interface_mtx, this->_internal_mtx};
+        // ステートメントは接続を閉じる前に破棄する。
+        _statement_cache.clear();
+        TaskTreeCache::detach(this->_db.get());
+        // 設定値は接続先のデータベースごとに異なるため、次回の参照時に読み込み直す。
+        SettingsStore::invalidate();
         this->_db = nullptr;
+        // 各スレッドの読み取り接続は、次のReadScopeの開始時に開き直される。
+        _connection_generation.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    DBManager::ReadScope::ReadScope()
+    {
+        ThreadReadState& state = thread_read_state;
+        // 入れ子の場合は、外側の読み取りトランザクションを共有する。
+        if (state.scope_depth++ > 0) return;
+        // 読み取り接続を用意できない場合は、書き込み用の接続で読み取る。
+        if (openDB() != 0) return;
+        if (const unsigned long long generation = _connection_generation.load(std::memory_order_relaxed);
+            !state.connection.isOpen() || state.connection.getGeneration() != generation) {
+            const std::string init_sql = DBPerformanceProfile::buildReadConnectionSql();
+            if (const int open_err = state.connection.open(_db_file_path.generic_string(), generation);
+                open_err != 0) {
+                Logger::warning(std::format("failed to open read connection. ({})", open_err), "DBManager");
+                return;
+            }
+            if (const int init_err = sqlite3_exec(state.connection.get(), init_sql.c_str(), nullptr, nullptr,
+                                                  nullptr);
+                init_err != SQLITE_OK) {
+                Logger::warning(std::format("failed to configure read connection. ({})", init_err), "DBManager");
+            }
+        }
+        if (sqlite3_exec(state.connection.get(), "BEGIN;", nullptr, nullptr, nullptr) != SQLITE_OK) return;
+        state.is_active = true;
+        _is_owner = true;
+    }
+
+    DBManager::ReadScope::~ReadScope()
+    {
+        ThreadReadState& state = thread_read_state;
+        state.scope_depth--;
+        if (!_is_owner) return;
+        state.is_active = false;
+        sqlite3_exec(state.connection.get(), "COMMIT;", nullptr, nullptr, nullptr);
+    }
+
+    // transaction()の内部と同様に、書き込み用の接続で読み取らせる。
+    DBManager::LatestReadScope::LatestReadScope() { thread_read_state.transaction_depth++; }
+
+    DBManager::LatestReadScope::~LatestReadScope() { thread_read_state.transaction_depth--; }
+
+    ReadConnection* DBManager::_activeReadConnection()
+    {
+        ThreadReadState& state = thread_read_state;
+        if (!state.is_active || state.transaction_depth > 0) return nullptr;
+        return &state.connection;
     }
 
     int DBManager::_initializeDB()
@@ -304,26 +858,82 @@ namespace core::db {
         );
     }
 
+    bool DBManager::_isSchemaStatement(sqlite3_stmt* stmt_)
+    {
+        if (sqlite3_stmt_readonly(stmt_)) return false;
+        const std::string_view sql = sqlite3_sql(stmt_);
+        const size_t keyword_begin = sql.find_first_not_of(" \t\r\n");
+        if (keyword_begin == std::string_view::npos) return false;
+        const std::string_view remaining = sql.substr(keyword_begin);
+        for (const std::string_view keyword : {"CREATE", "DROP", "ALTER"}) {
+            if (remaining.size() < keyword.size()) continue;
+            bool matched = true;
+            for (size_t i = 0; i < keyword.size(); i++) {
+                if (std::toupper(static_cast<unsigned char>(remaining[i])) != keyword[i]) {
+                    matched = false;
+                    break;
+                }
+            }
+            if (matched) return true;
+        }
+        return false;
+    }
+
     const std::regex front_gap_pattern{"^\\s+"};
 
-    void DBManager::_queryLogger(const std::chrono::time_point<std::chrono::high_resolution_clock> start_query_at_,
-                                 const std::string& sql_, const bool success_, const bool is_selected,
+    bool DBManager::_isQueryLogTarget()
+    {
+        if (!Logger::isQueryLogEnabled(Logger::LogLevel::DEBUG)) return false;
+        const size_t sampling = _query_log_sampling.load(std::memory_order_relaxed);
+        if (sampling <= 1) return true;
+        return _query_log_counter.fetch_add(1, std::memory_order_relaxed) % sampling == 0;
+    }
+
+    void DBManager::_queryLogger(sqlite3_stmt* stmt_,
+                                 const std::chrono::time_point<std::chrono::high_resolution_clock> start_query_at_,
+                                 const bool log_query_, const bool success_, const bool is_selected,
                                  const size_t rows_count_)
     {
+        // 計測していないクエリは出力対象外
+        if (start_query_at_ == std::chrono::high_resolution_clock::time_point{}) return;
         const auto end_query_at = std::chrono::high_resolution_clock::now();
-        std::string normalized_sql = std::regex_replace(sql_, front_gap_pattern, "");
+        const std::chrono::duration<double, std::milli> elapsed = end_query_at - start_query_at_;
+        QueryStats::record(stmt_, end_query_at - start_query_at_, success_, is_selected ? rows_count_ : 0,
+                           is_selected ? 0 : rows_count_);
+        const long long threshold = _slow_query_threshold_ms.load(std::memory_order_relaxed);
+        const bool is_slow = threshold > 0 && elapsed.count() >= static_cast<double>(threshold);
+        if (!log_query_ && !is_slow) return;
+
+        const auto expanded_sql = sqlite3ExpandedSqlWrapper(stmt_);
+        const std::string normalized_sql = std::regex_replace(expanded_sql == nullptr ? "" : expanded_sql.get(),
+                                                              front_gap_pattern, "");
         std::string summary{};
         if (is_selected || rows_count_ > 0) {
             summary = std::format("{} {} rows - ", is_selected ? "Selected" : "Affected", rows_count_);
         }
-        Logger::debug(
-            std::format(
-                "query:\n{}\n({} ms) {}{}.", normalized_sql,
-                std::chrono::duration<double, std::milli>(end_query_at - start_query_at_).count(),
-                summary,
-                success_ ? "ok" : "failed"
-            ),
-            "DBManager");
+        const std::string message = std::format(
+            "{}query:\n{}\n({} ms) {}{}.", is_slow ? "slow " : "", normalized_sql, elapsed.count(), summary,
+            success_ ? "ok" : "failed");
+        if (is_slow) Logger::warning(message, "DBManager");
+        else Logger::debug(message, "DBManager");
+    }
+
+    void DBManager::setQueryLogSampling(const size_t sample_every_)
+    {
+        _query_log_sampling.store(sample_every_ == 0 ? 1 : sample_every_, std::memory_order_relaxed);
+    }
+
+    void DBManager::setSlowQueryThreshold(const std::chrono::milliseconds threshold_)
+    {
+        _slow_query_threshold_ms.store(threshold_.count() < 0 ? 0 : threshold_.count(), std::memory_order_relaxed);
+    }
+
+    void DBManager::loadQueryLogSettings()
+    {
+        const auto settings = SettingsStore::snapshot();
+        if (settings->query_log_sampling.has_value()) setQueryLogSampling(*settings->query_log_sampling);
+        if (settings->slow_query_threshold_ms.has_value())
+            setSlowQueryThreshold(std::chrono::milliseconds(*settings->slow_query_threshold_ms));
     }
 
     std::unique_ptr<char, sqliteDeleter::SqliteStringDeleter> DBManager::sqlite3ExpandedSqlWrapper(sqlite3_stmt* stmt_)
@@ -339,18 +949,20 @@ namespace core::db {
     }
 
     int DatabaseTable::usePlaceholderUniSql(const std::string& sql_, std::vector<ColValue> placeholder_value_,
-                                            std::string& sql_remaining_)
+                                            std::string& sql_remaining_, const std::source_location& location_)
     {
-        return DBManager::usePlaceholderUniSql(sql_, _data, _binder, &placeholder_value_, sql_remaining_);
+        return DBManager::usePlaceholderUniSql(sql_, _data, _binder, &placeholder_value_, sql_remaining_, location_);
     }
 
-    int DatabaseTable::usePlaceholderUniSql(const std::string& sql_, std::vector<ColValue> placeholder_value_)
+    int DatabaseTable::usePlaceholderUniSql(const std::string& sql_, std::vector<ColValue> placeholder_value_,
+                                            const std::source_location& location_)
     {
         std::string sql_remaining{};
-        return DBManager::usePlaceholderUniSql(sql_, _data, _binder, &placeholder_value_, sql_remaining);
+        return DBManager::usePlaceholderUniSql(sql_, _data, _binder, &placeholder_value_, sql_remaining, location_);
     }
 
-    int DatabaseTable::columnTableConfiguredSql(const std::string& sql_, std::vector<ColValue> placeholder_value_)
+    int DatabaseTable::columnTableConfiguredSql(const std::string& sql_, std::vector<ColValue> placeholder_value_,
+                                                const std::source_location& location_)
     {
         std::string columns, unused_string;
         for (const std::string& col : _column_names) {
@@ -359,21 +971,25 @@ namespace core::db {
             columns += col;
         }
         const int ret_val = usePlaceholderUniSql(std::format("SELECT {} FROM {} {}", columns, _table_name, sql_),
-                                                 std::move(placeholder_value_), unused_string);
+                                                 std::move(placeholder_value_), unused_string, location_);
         _mapper();
         return ret_val;
     }
 
-    int DatabaseTable::selectRecords() { return selectRecords("", {}); }
+    int DatabaseTable::selectRecords(const std::source_location& location_)
+    {
+        return selectRecords("", {}, "", location_);
+    }
 
     int DatabaseTable::selectRecords(const std::string& where_clause_, const std::vector<ColValue>& placeholder_value_,
-                                     const std::string& order_by_)
+                                     const std::string& order_by_, const std::source_location& location_)
     {
-        return selectRecords(where_clause_, placeholder_value_, order_by_, -1, -1);
+        return selectRecords(where_clause_, placeholder_value_, order_by_, -1, -1, location_);
     }
 
     int DatabaseTable::selectRecords(const std::string& where_clause_, const std::vector<ColValue>& placeholder_value_,
-                                     const std::string& order_by_, const int limit_, const int offset_)
+                                     const std::string& order_by_, const int limit_, const int offset_,
+                                     const std::source_location& location_)
     {
         std::string columns;
         for (const std::string& col : _column_names) {
@@ -386,15 +1002,41 @@ namespace core::db {
             sql = std::format("SELECT {} FROM {}", columns, _table_name);
         else sql = std::format("SELECT {} FROM {} WHERE {}", columns, _table_name, where_clause_);
         if (!order_by_.empty()) sql = std::format("{} ORDER BY {}", sql, order_by_);
-        if (limit_ >= 0 && offset_ >= 0) sql = std::format("{} LIMIT {} OFFSET {}", sql, limit_, offset_);
+        // LIMIT, OFFSETはステートメントキャッシュを有効にするため、プレースホルダで指定する。
+        std::vector<ColValue> placeholder_values = placeholder_value_;
+        if (limit_ >= 0 && offset_ >= 0) {
+            sql += " LIMIT ? OFFSET ?";
+            placeholder_values.emplace_back(ColType::T_INTEGER, limit_);
+            placeholder_values.emplace_back(ColType::T_INTEGER, offset_);
+        }
         sql += ";";
         std::string unused_string;
-        const int ret_val = usePlaceholderUniSql(sql, placeholder_value_, unused_string);
+        const int ret_val = usePlaceholderUniSql(sql, std::move(placeholder_values), unused_string, location_);
         _mapper();
         return ret_val;
     }
 
-    const Table& DatabaseTable::getRawTable() { return _data; }
+    int DatabaseTable::selectEach(const std::string& where_clause_, const std::vector<ColValue>& placeholder_value_,
+                                  const std::string& order_by_, const RowCallback& on_row_, const size_t max_rows_,
+                                  const std::source_location& location_)
+    {
+        std::string columns;
+        for (const std::string& col : _column_names) {
+            if (!columns.empty())
+                columns += ", ";
+            columns += col;
+        }
+        std::string sql;
+        if (where_clause_.empty())
+            sql = std::format("SELECT {} FROM {}", columns, _table_name);
+        else sql = std::format("SELECT {} FROM {} WHERE {}", columns, _table_name, where_clause_);
+        if (!order_by_.empty()) sql = std::format("{} ORDER BY {}", sql, order_by_);
+        sql += ";";
+        std::vector<ColValue> placeholder_values = placeholder_value_;
+        return DBManager::forEachRow(sql, _binder, &placeholder_values, on_row_, max_rows_, location_);
+    }
+
+    const ResultSet& DatabaseTable::getRawTable() { return _data; }
 
     const std::vector<std::string>& DatabaseTable::getColumnNames() { return _column_names; }
 
@@ -402,30 +1044,7 @@ namespace core::db {
 
     int DatabaseTable::_binder(void* bind_arg_, sqlite3_stmt* stmt)
     {
-        const auto bind_values = static_cast<std::vector<ColValue>*>(bind_arg_);
-        int binder_err = 0;
-        for (int i = 0; i < bind_values->size(); i++) {
-            const int placeholder_i = i + 1;
-            switch (auto [column_type, value] = bind_values->at(i); column_type) {
-            case ColType::T_REAL:
-                binder_err = sqlite3_bind_double(stmt, placeholder_i, std::get<double>(value));
-                break;
-            case ColType::T_INTEGER:
-                binder_err = sqlite3_bind_int64(stmt, placeholder_i, std::get<long long>(value));
-                break;
-            case ColType::T_TEXT:
-                binder_err = sqlite3_bind_text(stmt, placeholder_i, std::get<std::string>(value).c_str(), -1,
-                                               SQLITE_TRANSIENT);
-                break;
-            case ColType::T_NULL:
-                binder_err = sqlite3_bind_null(stmt, placeholder_i);
-                break;
-            }
-            if (binder_err != SQLITE_OK) {
-                return DBManager::getPrefixedErrorCode(binder_err, DBManager::ErrorPrefix::BIND_ERROR);
-            }
-        }
-        return SQLITE_OK;
+        return bindValues(stmt, *static_cast<std::vector<ColValue>*>(bind_arg_));
     }
 
     void DatabaseTable::_mapper()
@@ -467,135 +1086,283 @@ namespace core::db {
     const std::vector<long long>& TaskTable::getKeys() const { return _keys; }
 
     std::pair<int, std::string> TaskTable::fetchChildTasks(long long parent_task_id_, const int status_filter_,
-                                                           const int page_, const int per_page_)
+                                                           const int page_, const int per_page_,
+                                                           const std::source_location& location_)
     {
-        std::string parent_task_name;
-        std::vector<ColValue> placeholder_values{};
-        std::string where_clause{};
-        TaskTable select_parent_task_name{};
+        const CallSiteScope call_site(location_);
+        // ページングしない場合は、LIMITに負の値を指定して全件を取得する。
+        const bool is_paging = page_ >= 0 && per_page_ >= 0;
+        const auto [err, page] = fetchChildTaskPage(parent_task_id_, status_filter_, is_paging ? per_page_ : -1,
+                                                    TaskPageSeek::OFFSET, {},
+                                                    is_paging ? static_cast<long long>(page_ - 1) * per_page_ : 0);
+        if (err != 0) { return {2, page.parent_name}; }
+        return {0, page.parent_name};
+    }
 
-        // 親タスク名を取得する。
-        if (const int err = select_parent_task_name.selectRecords("id=?", {
-                                                                      {ColType::T_INTEGER, parent_task_id_}
-                                                                  }); err != 0) { return {1, ""}; }
-        if (select_parent_task_name.getTable().contains(parent_task_id_)) {
-            parent_task_name = select_parent_task_name.getTable().at(parent_task_id_).name;
+    std::pair<int, ChildTaskPage> TaskTable::fetchChildTaskPage(const long long parent_task_id_,
+                                                                const int status_filter_, const int per_page_,
+                                                                const TaskPageSeek seek_, const TaskPageKey& key_,
+                                                                const long long offset_,
+                                                                const std::source_location& location_)
+    {
+        const CallSiteScope call_site(location_);
+        // ?1: 親タスクID, ?2: 1ページ当たりのタスク数, ?3: ステータスID, ?4-?6: キーまたは読み飛ばす件数
+        std::vector<ColValue> placeholder_values{
+            parent_task_id_ <= 0 ? ColValue{ColType::T_NULL, nullptr} : ColValue{ColType::T_INTEGER, parent_task_id_},
+            {ColType::T_INTEGER, static_cast<long long>(per_page_)}
+        };
+
+        // フィルタが有効な範囲であれば、総数とページの両方をステータスIDで絞り込む。
+        // ステータスIDが一定の場合、並び順とキーの比較からstatus_idを除き、インデックスの順序のみで並べる。
+        std::string count_cond = "parent_id = coalesce(?1, 0)";
+        std::string page_cond = "parent_id IS ?1";
+        std::string key_columns = "status_id, name, id";
+        std::string key_values = "?4, ?5, ?6";
+        std::string reverse_order = "status_id DESC, name DESC, id DESC";
+        if (status_filter_ > 0 && status_filter_ <= 4) {
+            count_cond += " AND status_id = ?3";
+            page_cond += " AND status_id = ?3";
+            key_columns = "name, id";
+            key_values = "?5, ?6";
+            reverse_order = "name DESC, id DESC";
+            placeholder_values.emplace_back(ColType::T_INTEGER, static_cast<long long>(status_filter_));
+        }
+        else { placeholder_values.emplace_back(ColType::T_NULL, nullptr); }
+
+        // ページの範囲を指定する。BEFOREは逆順に取得し、取得後に並べ直す。
+        std::string order_by = key_columns;
+        std::string limit = "LIMIT ?2";
+        switch (seek_) {
+        case TaskPageSeek::AFTER:
+        case TaskPageSeek::BEFORE:
+            page_cond += std::format(" AND ({}) {} ({})", key_columns, seek_ == TaskPageSeek::AFTER ? ">" : "<",
+                                     key_values);
+            if (seek_ == TaskPageSeek::BEFORE) order_by = reverse_order;
+            placeholder_values.emplace_back(ColType::T_INTEGER, key_.status_id);
+            placeholder_values.emplace_back(ColType::T_TEXT, key_.name);
+            placeholder_values.emplace_back(ColType::T_INTEGER, key_.id);
+            break;
+        case TaskPageSeek::OFFSET:
+            limit += " OFFSET ?4";
+            placeholder_values.emplace_back(ColType::T_INTEGER, offset_);
+            break;
         }
-        else { parent_task_name = ""; }
 
-        // フィルタが有効な場合は設定する。
-        if (status_filter_ != 0) {
-            where_clause = "status_id=? AND ";
-            placeholder_values.emplace_back(ColType::T_INTEGER, status_filter_);
+        // ページが空でも親タスク名と総数を返すため、1行のheaderにページを外部結合する。
+        // 総数はトリガーにより更新されるtask_child_countから求め、子タスクを数えない。
+        const std::string sql = std::format(
+            "SELECT header.parent_name, header.total_count, page.*"
+            " FROM (SELECT (SELECT name FROM task WHERE id = ?1) AS parent_name,"
+            " (SELECT coalesce(SUM(child_count), 0) FROM task_child_count WHERE {}) AS total_count) AS header"
+            " LEFT JOIN (SELECT * FROM task WHERE {} ORDER BY {} {}) AS page;",
+            count_cond, page_cond, order_by, limit);
+        if (const int err = usePlaceholderUniSql(sql, std::move(placeholder_values)); err != 0) {
+            return {err, ChildTaskPage()};
         }
 
-        // parent_id_を指定する。
-        if (parent_task_id_ <= 0) { where_clause += "parent_id IS NULL"; }
-        else {
-            where_clause += "parent_id=?";
-            placeholder_values.emplace_back(ColType::T_INTEGER, parent_task_id_);
+        ChildTaskPage page;
+        if (!_data.empty()) {
+            page.parent_name = _data.getString(0, _data.columnIndex("parent_name"));
+            page.total_count = _data.getLongLong(0, _data.columnIndex("total_count"));
+        }
+        _mapper();
+
+        _sortKeysByPageOrder();
+        return {0, page};
+    }
+
+    std::pair<int, TaskLocation> TaskTable::locateTask(const long long task_id_, const int status_filter_,
+                                                       const int per_page_,
+                                                       const std::source_location& location_)
+    {
+        const CallSiteScope call_site(location_);
+        if (per_page_ <= 0) return {-1, TaskLocation()};
+
+        // ?1: タスクID, ?2: 1ページ当たりのタスク数, ?3: ステータスID
+        std::vector<ColValue> placeholder_values{
+            {ColType::T_INTEGER, task_id_},
+            {ColType::T_INTEGER, static_cast<long long>(per_page_)}
+        };
+        std::string target_cond = "id = ?1";
+        std::string count_cond = "parent_id = coalesce((SELECT parent_id FROM target), 0)";
+        const bool is_filtered = status_filter_ > 0 && status_filter_ <= 4;
+        if (is_filtered) {
+            target_cond += " AND status_id = ?3";
+            count_cond += " AND status_id = ?3";
+            placeholder_values.emplace_back(ColType::T_INTEGER, static_cast<long long>(status_filter_));
+        }
+        const std::string order_by = is_filtered ? "task.name, task.id" : "task.status_id, task.name, task.id";
+        const std::string reverse_order = is_filtered
+                                              ? "task.name DESC, task.id DESC"
+                                              : "task.status_id DESC, task.name DESC, task.id DESC";
+
+        const std::string preceding_cond = _siblingOrderCondition(is_filtered, "<");
+
+        // docs/taskFromPageNumber.sqlに記載
+        // 対象より前の兄弟タスクの数を順位とし、ページ内で対象より前の行と、対象以降の行を連結してページとする。
+        const std::string sql = std::format(
+            "WITH target AS (SELECT id, parent_id, status_id, name FROM task WHERE {}),"
+            " ranked AS (SELECT COUNT(*) AS task_rank FROM task WHERE {})"
+            " SELECT (SELECT COUNT(*) FROM target) AS is_found,"
+            " (SELECT parent_id FROM target) AS target_parent_id,"
+            " (SELECT name FROM task WHERE id = (SELECT parent_id FROM target)) AS parent_name,"
+            " (SELECT coalesce(SUM(child_count), 0) FROM task_child_count WHERE {}) AS total_count,"
+            " ranked.task_rank, page.*"
+            " FROM ranked LEFT JOIN ("
+            "SELECT * FROM (SELECT task.* FROM task WHERE {} ORDER BY {}"
+            " LIMIT (SELECT task_rank FROM ranked) % ?2)"
+            " UNION ALL"
+            " SELECT * FROM (SELECT task.* FROM task WHERE {} ORDER BY {}"
+            " LIMIT ?2 - (SELECT task_rank FROM ranked) % ?2)) AS page;",
+            target_cond, preceding_cond, count_cond, preceding_cond, reverse_order,
+            _siblingOrderCondition(is_filtered, ">="), order_by);
+        if (const int err = usePlaceholderUniSql(sql, std::move(placeholder_values)); err != 0) {
+            return {err, TaskLocation()};
+        }
+
+        // 対象のタスクが存在するか確認
+        if (_data.empty() || _data.getLongLong(0, _data.columnIndex("is_found")) == 0) {
+            _mapper();
+            return {-2, TaskLocation()};
+        }
+
+        TaskLocation location;
+        location.parent_id = _data.getLongLong(0, _data.columnIndex("target_parent_id"));
+        const long long rank = _data.getLongLong(0, _data.columnIndex("task_rank"));
+        location.page_num = rank / per_page_ + 1;
+        location.page_pos = rank % per_page_;
+        location.page.parent_name = _data.getString(0, _data.columnIndex("parent_name"));
+        location.page.total_count = _data.getLongLong(0, _data.columnIndex("total_count"));
+        _mapper();
+        _sortKeysByPageOrder();
+        return {0, location};
+    }
+
+    void TaskTable::_sortKeysByPageOrder()
+    {
+        // 外部結合した結果の順序に依存せず、(status_id, name, id)の昇順に並べる。
+        std::ranges::sort(_keys, [this](const long long a_, const long long b_) {
+            const Task& a = _table.at(a_);
+            const Task& b = _table.at(b_);
+            return std::tie(a.status_id, a.name, a.id) < std::tie(b.status_id, b.name, b.id);
+        });
+    }
+
+    std::string TaskTable::_siblingOrderCondition(const bool is_filtered_, const std::string_view operator_)
+    {
+        // targetは結合せずスカラー副問合せで参照し、taskのみをインデックスの順序で走査させる。
+        // ステータスで絞り込む場合、status_idはtargetと等しいため、比較から除きインデックスの順序のみで検索する。
+        if (is_filtered_) {
+            return std::format("task.parent_id IS (SELECT parent_id FROM target)"
+                               " AND task.status_id = (SELECT status_id FROM target)"
+                               " AND (task.name, task.id) {} (SELECT name, id FROM target)", operator_);
         }
+        return std::format("task.parent_id IS (SELECT parent_id FROM target)"
+                           " AND (task.status_id, task.name, task.id) {} (SELECT status_id, name, id FROM target)",
+                           operator_);
+    }
 
-        // タスクテーブルを最新のparent_idのものに更新する。
-        const int select_err = this->selectRecords(where_clause, placeholder_values,
-                                                   "status_id, name ASC",
-                                                   per_page_,
-                                                   (page_ - 1) * per_page_);
-        if (select_err != 0) { return {2, parent_task_name}; }
-        return {0, parent_task_name};
+    TaskPageKey TaskTable::getPageKey(const size_t pos_) const
+    {
+        if (pos_ >= _keys.size()) return TaskPageKey();
+        const Task& task = _table.at(_keys.at(pos_));
+        return TaskPageKey{task.status_id, task.name, task.id};
     }
 
-    std::pair<int, long long> TaskTable::countChildTasks(const long long parent_task_id_, const int filter_status_)
+    std::pair<int, long long> TaskTable::countChildTasks(const long long parent_task_id_, const int filter_status_,
+                                                         const std::source_location& location_)
     {
+        const CallSiteScope call_site(location_);
         std::string unuse;
         std::string cond{};
+        std::vector<ColValue> placeholder_values{};
 
-        // 親タスクのIDを指定する。
-        if (parent_task_id_ <= 0) { cond = "parent_id IS NULL"; }
-        else { cond = "parent_id=" + std::to_string(parent_task_id_); }
+        // 親タスクのIDを指定する。task_child_countでは、親タスクがない場合を0として扱う。
+        cond = "parent_id=?";
+        placeholder_values.emplace_back(ColType::T_INTEGER, parent_task_id_ <= 0 ? 0LL : parent_task_id_);
 
         // フィルタが有効な範囲であれば、ステータスIDでフィルタリングする。
-        if (filter_status_ > 0 && filter_status_ <= 4) cond += " AND status_id=" + std::to_string(filter_status_);
+        if (filter_status_ > 0 && filter_status_ <= 4) {
+            cond += " AND status_id=?";
+            placeholder_values.emplace_back(ColType::T_INTEGER, filter_status_);
+        }
 
+        // 子タスクを数えず、トリガーにより更新されるtask_child_countを合計する。
         TaskTable tmp_table{};
         if (int err = tmp_table.usePlaceholderUniSql(
-            std::format("SELECT COUNT(ID) AS task_count FROM task WHERE {};", cond),
-            {},
+            std::format("SELECT coalesce(SUM(child_count), 0) AS task_count FROM task_child_count WHERE {};", cond),
+            std::move(placeholder_values),
             unuse
         ); err != 0)
             return {err, 0};
 
         // データが正常に取得できているなら、その値を返す。
         // レコードの存在確認
-        if (const auto raw_table = tmp_table.getRawTable(); !raw_table.empty()) {
+        if (const auto& raw_table = tmp_table.getRawTable(); !raw_table.empty()) {
             // 列の存在確認
-            if (const auto& front = raw_table.front(); front.contains("task_count")) {
+            if (const int col = raw_table.columnIndex("task_count"); col >= 0) {
                 // 型チェック
-                if (auto [type, value] = front.at("task_count"); type == ColType::T_INTEGER) {
-                    return {0, std::get<long long>(value)};
-                }
+                if (raw_table.getType(0, col) == ColType::T_INTEGER) { return {0, raw_table.getLongLong(0, col)}; }
             }
         }
         return {-1, 0};
     }
 
     std::pair<int, std::pair<long long, long long>> TaskTable::fetchPageNumAndFocusFromTask(
-        const long long task_id_, const int status_filter_, const int per_page_)
+        const long long task_id_, const int status_filter_, const int per_page_,
+        const std::source_location& location_)
     {
+        const CallSiteScope call_site(location_);
         std::string unuse;
         std::string sql{};
         TaskTable tmp_tbl;
 
-        // 対象のタスクを取得。
-        const auto [fetch_task_err, task] = fetchTask(task_id_);
-        if (fetch_task_err != 0) return {-1, {-1, -1}};
-        long long parent_task_id = task.parent_id;
-
         // SQLを動的に組み立てる
         // docs/taskFromPageNumber.sqlに記載
-        sql = "SELECT (row_id - 1) / " + std::to_string(per_page_) + " + 1 AS page_num,";
-        sql += " (row_id - 1) % " + std::to_string(per_page_) + " AS page_pos";
-        sql += " FROM (";
-        sql += " SELECT id, row_number() over (ORDER BY status_id, name) AS row_id";
-        sql += " FROM task WHERE parent_id";
-
-        // 親タスクIDを設定。0以下であればNULLとみなす。
-        if (parent_task_id <= 0) { sql += " IS NULL"; }
-        else { sql += "=" + std::to_string(parent_task_id); }
+        // ?1: 1ページ当たりのタスク数, ?2: タスクID, ?3: ステータスID
+        std::vector<ColValue> placeholder_values{
+            {ColType::T_INTEGER, static_cast<long long>(per_page_)},
+            {ColType::T_INTEGER, task_id_}
+        };
+        sql = "WITH target AS (SELECT id, parent_id, status_id, name FROM task WHERE id=?2";
 
         // 取得対象のステータスIDを設定。範囲外なら設定しない。
-        if (status_filter_ > 0 && status_filter_ <= 4) { sql += " AND status_id=" + std::to_string(status_filter_); }
+        const bool is_filtered = status_filter_ > 0 && status_filter_ <= 4;
+        if (is_filtered) {
+            sql += " AND status_id=?3";
+            placeholder_values.emplace_back(ColType::T_INTEGER, static_cast<long long>(status_filter_));
+        }
 
-        // タスクIDで絞り込む。
-        sql += ") WHERE id=" + std::to_string(task_id_) + ";";
+        // 対象より前の兄弟タスクの数から、ページ番号とページ内での位置を求める。
+        sql += ") SELECT task_rank / ?1 + 1 AS page_num, task_rank % ?1 AS page_pos";
+        sql += std::format(" FROM (SELECT COUNT(*) AS task_rank FROM task WHERE {})",
+                           _siblingOrderCondition(is_filtered, "<"));
+        sql += " WHERE EXISTS (SELECT 1 FROM target);";
 
         // SQLを実行。
-        if (const auto err = tmp_tbl.usePlaceholderUniSql(sql, {}, unuse);
+        if (const auto err = tmp_tbl.usePlaceholderUniSql(sql, std::move(placeholder_values), unuse);
             err != 0) { return {err, {-1, -1}}; }
 
         // テーブルに値が存在するか確認
-        const auto raw_tbl = tmp_tbl.getRawTable();
+        const auto& raw_tbl = tmp_tbl.getRawTable();
         if (raw_tbl.empty()) return {-2, {-1, -1}};
-        if (!raw_tbl.front().contains("page_num") || !raw_tbl.front().contains("page_pos")) return {-3, {-1, -1}};
+        const int col_num = raw_tbl.columnIndex("page_num");
+        const int col_pos = raw_tbl.columnIndex("page_pos");
+        if (col_num < 0 || col_pos < 0) return {-3, {-1, -1}};
 
         // ページ番号を取得
-        long long page_number = 0;
-        const auto [type_num, val_num] = raw_tbl.front().at("page_num");
-        if (
-            type_num != ColType::T_INTEGER) { return {-4, {-1, -1}}; }
-        page_number = std::get<long long>(val_num);
+        if (raw_tbl.getType(0, col_num) != ColType::T_INTEGER) { return {-4, {-1, -1}}; }
+        const long long page_number = raw_tbl.getLongLong(0, col_num);
 
         // ページ内での位置を取得
-        long long page_pos = 0;
-        const auto [type_pos, val_pos] = raw_tbl.front().at("page_pos");
-        if (
-            type_pos != ColType::T_INTEGER) { return {-5, {-1, -1}}; }
-        page_pos = std::get<long long>(val_pos);
+        if (raw_tbl.getType(0, col_pos) != ColType::T_INTEGER) { return {-5, {-1, -1}}; }
+        const long long page_pos = raw_tbl.getLongLong(0, col_pos);
         return {0, {page_number, page_pos}};
     }
 
-    std::pair<int, Task> TaskTable::fetchTask(long long task_id_)
+    std::pair<int, Task> TaskTable::fetchTask(long long task_id_, const std::source_location& location_)
     {
+        const CallSiteScope call_site(location_);
         TaskTable table;
         if (const int err = table.selectRecords("id=?", {{ColType::T_INTEGER, task_id_}}); err != 0) {
             return {err, Task()};
@@ -605,8 +1372,10 @@ namespace core::db {
         return {0, task};
     }
 
-    std::pair<int, std::chrono::seconds> TaskTable::computeTotalWorktime(long long task_id_)
+    std::pair<int, std::chrono::seconds> TaskTable::computeTotalWorktime(long long task_id_,
+                                                                         const std::source_location& location_)
     {
+        const CallSiteScope call_site(location_);
         using namespace std::chrono_literals;
         TaskTable table;
         int err = table.usePlaceholderUniSql(
@@ -616,29 +1385,36 @@ namespace core::db {
             }
         );
         if (err != 0) return {err, -1s};
-        if (table.getRawTable().empty()) return {-1, -1s};
-        if (!table.getRawTable().front().contains("total_worktime")) return {-2, -1s};
-        return {0, std::chrono::seconds(getLongLong(table.getRawTable().front().at("total_worktime")))};
+        const auto& raw_tbl = table.getRawTable();
+        if (raw_tbl.empty()) return {-1, -1s};
+        const int col = raw_tbl.columnIndex("total_worktime");
+        if (col < 0) return {-2, -1s};
+        return {0, std::chrono::seconds(raw_tbl.getLongLong(0, col))};
     }
 
-    std::pair<int, std::chrono::seconds> TaskTable::fetchWorktime(const long long task_id_)
+    std::pair<int, std::chrono::seconds> TaskTable::fetchWorktime(const long long task_id_,
+                                                                  const std::source_location& location_)
     {
+        const CallSiteScope call_site(location_);
         using namespace std::chrono_literals;
         TaskTable table;
         int err = table.usePlaceholderUniSql(
-            "SELECT total_worktime FROM total_worktime_group_by_task WHERE task_id=?;",
+            "SELECT total_worktime FROM task_worktime_total WHERE task_id = ?;",
             {
                 {ColType::T_INTEGER, task_id_}
             }
         );
         if (err != 0) return {err, -1s};
-        if (table.getRawTable().empty()) return {-1, -1s};
-        if (!table.getRawTable().front().contains("total_worktime")) return {-2, -1s};
-        return {0, std::chrono::seconds(getLongLong(table.getRawTable().front().at("total_worktime")))};
+        const auto& raw_tbl = table.getRawTable();
+        if (raw_tbl.empty()) return {-1, -1s};
+        const int col = raw_tbl.columnIndex("total_worktime");
+        if (col < 0) return {-2, -1s};
+        return {0, std::chrono::seconds(raw_tbl.getLongLong(0, col))};
     }
 
-    std::pair<int, Task> TaskTable::fetchLastTask(const long long parent_id)
+    std::pair<int, Task> TaskTable::fetchLastTask(const long long parent_id, const std::source_location& location_)
     {
+        const CallSiteScope call_site(location_);
         TaskTable table;
         auto placeholder = std::vector<ColValue>();
 
@@ -653,8 +1429,9 @@ namespace core::db {
         return {0, table.getTable().at(table.getKeys().front())};
     }
 
-    int TaskTable::newTask(long long parent_id)
+    int TaskTable::newTask(long long parent_id, const std::source_location& location_)
     {
+        const CallSiteScope call_site(location_);
         TaskTable table;
         const int err = table.usePlaceholderUniSql(
             "INSERT INTO task(parent_id, name, status_id) VALUES (?, 'New Task', 2);", {
@@ -665,8 +1442,9 @@ namespace core::db {
         return 0;
     }
 
-    int TaskTable::deleteTask(const long long task_id)
+    int TaskTable::deleteTask(const long long task_id, const std::source_location& location_)
     {
+        const CallSiteScope call_site(location_);
         TaskTable tbl;
         return tbl.usePlaceholderUniSql(
             "DELETE FROM task WHERE id = ?;",
@@ -674,8 +1452,10 @@ namespace core::db {
         );
     }
 
-    bool TaskTable::computeIsSiblings(const long long sibling_task_id, const long long parent_id)
+    bool TaskTable::computeIsSiblings(const long long sibling_task_id, const long long parent_id,
+                                      const std::source_location& location_)
     {
+        const CallSiteScope call_site(location_);
         TaskTable tbl;
         if (tbl.usePlaceholderUniSql(
             std::string(F_IS_TASK_SIBLINGS_SQL, SIZE_IS_TASK_SIBLINGS_SQL),
@@ -683,26 +1463,67 @@ namespace core::db {
                 {ColType::T_INTEGER, sibling_task_id}, {ColType::T_INTEGER, parent_id}
             }) != 0)
             return false;
-        if (tbl.getRawTable().empty()) return false;
-        return getLongLong(tbl.getRawTable().front().at("result")) == 1;
+        const auto& raw_tbl = tbl.getRawTable();
+        if (raw_tbl.empty()) return false;
+        return raw_tbl.getLongLong(0, raw_tbl.columnIndex("result")) == 1;
+    }
+
+    std::pair<int, TaskDetailSnapshot> TaskTable::fetchDetailSnapshot(const long long task_id_,
+                                                                        const long long active_task_id_,
+                                                                        const std::source_location& location_)
+    {
+        const CallSiteScope call_site(location_);
+        TaskTable table;
+        if (const int err = table.usePlaceholderUniSql(
+            std::string(F_TASK_DETAIL_SNAPSHOT_SQL, SIZE_TASK_DETAIL_SNAPSHOT_SQL),
+            {
+                {ColType::T_INTEGER, task_id_}, {ColType::T_INTEGER, active_task_id_}
+            }); err != 0) { return {err, TaskDetailSnapshot()}; }
+        table._mapper();
+        if (table.getKeys().empty()) return {-2, TaskDetailSnapshot()};
+        const auto& raw_tbl = table.getRawTable();
+        const int col_task_worktime = raw_tbl.columnIndex("task_worktime");
+        const int col_subtree_worktime = raw_tbl.columnIndex("subtree_worktime");
+        const int col_is_active_task_family = raw_tbl.columnIndex("is_active_task_family");
+        if (col_task_worktime < 0 || col_subtree_worktime < 0 || col_is_active_task_family < 0)
+            return {-1, TaskDetailSnapshot()};
+        TaskDetailSnapshot snapshot;
+        snapshot.task.emplace(table.getTable().at(table.getKeys().front()));
+        snapshot.task_worktime = std::chrono::seconds(raw_tbl.getLongLong(0, col_task_worktime));
+        snapshot.subtree_worktime = std::chrono::seconds(raw_tbl.getLongLong(0, col_subtree_worktime));
+        snapshot.is_active_task_family = raw_tbl.getLongLong(0, col_is_active_task_family) == 1;
+        return {0, snapshot};
     }
 
     void TaskTable::_mapper()
     {
         _keys.clear();
         _table.clear();
-        for (auto i : _data) {
-            _keys.emplace_back(getLongLong(i.at("id")));
+        // 列番号は行ごとに引かず、最初に一度だけ解決する。
+        const int col_id = _data.columnIndex("id");
+        const int col_parent_id = _data.columnIndex("parent_id");
+        const int col_name = _data.columnIndex("name");
+        const int col_detail = _data.columnIndex("detail");
+        const int col_status_id = _data.columnIndex("status_id");
+        const int col_created_at = _data.columnIndex("created_at");
+        const int col_updated_at = _data.columnIndex("updated_at");
+        _keys.reserve(_data.rowCount());
+        _table.reserve(_data.rowCount());
+        for (size_t row = 0; row < _data.rowCount(); row++) {
+            // 外部結合で一致する行がない場合、idはNULLになるため対象外とする。
+            if (_data.getType(row, col_id) != ColType::T_INTEGER) continue;
+            const long long id = _data.getLongLong(row, col_id);
+            _keys.emplace_back(id);
             _table.try_emplace(
-                getLongLong(i.at("id")),
+                id,
                 Task({
-                    getLongLong(i.at("id")),
-                    getLongLong(i.at("parent_id")),
-                    getString(i.at("name")),
-                    getString(i.at("detail")),
-                    getLongLong(i.at("status_id")),
-                    getLongLong(i.at("created_at")),
-                    getLongLong(i.at("updated_at"))
+                    id,
+                    _data.getLongLong(row, col_parent_id),
+                    _data.getString(row, col_name),
+                    _data.getString(row, col_detail),
+                    _data.getLongLong(row, col_status_id),
+                    _data.getLongLong(row, col_created_at),
+                    _data.getLongLong(row, col_updated_at)
                 }));
         }
     }
@@ -747,19 +1568,28 @@ namespace core::db {
     {
         _keys.clear();
         _table.clear();
-        for (auto i : _data) {
-            _keys.emplace_back(getLongLong(i.at("id")));
+        // 列番号は行ごとに引かず、最初に一度だけ解決する。
+        const int col_id = _data.columnIndex("id");
+        const int col_task_id = _data.columnIndex("task_id");
+        const int col_starting_time = _data.columnIndex("starting_time");
+        const int col_finishing_time = _data.columnIndex("finishing_time");
+        const int col_created_at = _data.columnIndex("created_at");
+        const int col_updated_at = _data.columnIndex("updated_at");
+        _keys.reserve(_data.rowCount());
+        _table.reserve(_data.rowCount());
+        for (size_t row = 0; row < _data.rowCount(); row++) {
+            const long long id = _data.getLongLong(row, col_id);
+            _keys.emplace_back(id);
             _table.try_emplace(
-                getLongLong(i.at("id")),
+                id,
                 Schedule({
-                    getLongLong(i.at("id")),
-                    getLongLong(i.at("task_id")),
-                    getLongLong(i.at("starting_time")),
-                    getLongLong(i.at("finishing_time")),
-                    getLongLong(i.at("created_at")),
-                    getLongLong(i.at("updated_at"))
-                })
-            );
+                    id,
+                    _data.getLongLong(row, col_task_id),
+                    _data.getLongLong(row, col_starting_time),
+                    _data.getLongLong(row, col_finishing_time),
+                    _data.getLongLong(row, col_created_at),
+                    _data.getLongLong(row, col_updated_at)
+                }));
         }
     }
 
@@ -789,17 +1619,24 @@ namespace core::db {
     {
         _keys.clear();
         _table.clear();
-        for (auto i : _data) {
-            _keys.emplace_back(getLongLong(i.at("id")));
+        // 列番号は行ごとに引かず、最初に一度だけ解決する。
+        const int col_id = _data.columnIndex("id");
+        const int col_applied = _data.columnIndex("applied");
+        const int col_created_at = _data.columnIndex("created_at");
+        const int col_updated_at = _data.columnIndex("updated_at");
+        _keys.reserve(_data.rowCount());
+        _table.reserve(_data.rowCount());
+        for (size_t row = 0; row < _data.rowCount(); row++) {
+            const long long id = _data.getLongLong(row, col_id);
+            _keys.emplace_back(id);
             _table.try_emplace(
-                getLongLong(i.at("id")),
+                id,
                 Migrate({
-                    getLongLong(i.at("id")),
-                    getLongLong(i.at("applied")),
-                    getLongLong(i.at("created_at")),
-                    getLongLong(i.at("updated_at"))
-                })
-            );
+                    id,
+                    _data.getLongLong(row, col_applied),
+                    _data.getLongLong(row, col_created_at),
+                    _data.getLongLong(row, col_updated_at)
+                }));
         }
     }
 
@@ -832,18 +1669,26 @@ namespace core::db {
     {
         _keys.clear();
         _table.clear();
-        for (auto i : _data) {
-            _keys.emplace_back(getLongLong(i.at("id")));
+        // 列番号は行ごとに引かず、最初に一度だけ解決する。
+        const int col_id = _data.columnIndex("id");
+        const int col_setting_key = _data.columnIndex("setting_key");
+        const int col_value = _data.columnIndex("value");
+        const int col_created_at = _data.columnIndex("created_at");
+        const int col_updated_at = _data.columnIndex("updated_at");
+        _keys.reserve(_data.rowCount());
+        _table.reserve(_data.rowCount());
+        for (size_t row = 0; row < _data.rowCount(); row++) {
+            const long long id = _data.getLongLong(row, col_id);
+            _keys.emplace_back(id);
             _table.try_emplace(
-                getLongLong(i.at("id")),
+                id,
                 Setting({
-                    getLongLong(i.at("id")),
-                    getString(i.at("setting_key")),
-                    getString(i.at("value")),
-                    getLongLong(i.at("created_at")),
-                    getLongLong(i.at("updated_at"))
-                })
-            );
+                    id,
+                    _data.getString(row, col_setting_key),
+                    _data.getString(row, col_value),
+                    _data.getLongLong(row, col_created_at),
+                    _data.getLongLong(row, col_updated_at)
+                }));
         }
     }
 
@@ -855,7 +1700,7 @@ namespace core::db {
                                                       "created_at",
                                                       "updated_at"
                                                   },
-                                                  "null_set_worktime")
+                                                  "worktime")
     {
     }
 
@@ -863,46 +1708,56 @@ namespace core::db {
 
     const std::vector<long long>& WorktimeTable::getKeys() const { return _keys; }
 
-    int WorktimeTable::ensureOnlyOneActiveTask()
+    int WorktimeTable::ensureOnlyOneActiveTask(const std::source_location& location_)
     {
+        const CallSiteScope call_site(location_);
         WorktimeTable table;
         return table.usePlaceholderUniSql(std::string(F_CHANGE_TO_ONLY_ONE_TASK_SQL, SIZE_CHANGE_TO_ONLY_ONE_TASK_SQL));
     }
 
-    int WorktimeTable::deactivateAllTasks()
+    int WorktimeTable::deactivateAllTasks(const std::source_location& location_)
     {
+        const CallSiteScope call_site(location_);
         WorktimeTable table;
         return table.usePlaceholderUniSql(
             "UPDATE worktime SET finishing_time = (strftime('%s', DATETIME('now'))) WHERE finishing_time IS NULL;");
     }
 
-    int WorktimeTable::selectActiveTask()
+    int WorktimeTable::selectActiveTask(const std::source_location& location_)
     {
+        const CallSiteScope call_site(location_);
         const int err = usePlaceholderUniSql(std::string(F_SELECT_ACTIVE_TASK_SQL, SIZE_SELECT_ACTIVE_TASK_SQL));
         if (err != 0) return err;
         _mapper();
         return 0;
     }
 
-    int WorktimeTable::activateTask(const long long task_id_)
+    int WorktimeTable::activateTask(const long long task_id_, const std::source_location& location_)
     {
-        WorktimeTable table;
-        deactivateAllTasks();
-        return table.usePlaceholderUniSql("INSERT INTO worktime(task_id) VALUES (?);", {
-                                              {ColType::T_INTEGER, task_id_}
-                                          });
+        const CallSiteScope call_site(location_);
+        // 作業の終了と開始を1つのトランザクションで行い、コミットを1回にまとめる。
+        return DBManager::transaction([task_id_] {
+            if (const int err = deactivateAllTasks(); err != 0) return err;
+            WorktimeTable table;
+            return table.usePlaceholderUniSql("INSERT INTO worktime(task_id) VALUES (?);", {
+                                                  {ColType::T_INTEGER, task_id_}
+                                              });
+        });
     }
 
-    int WorktimeTable::updateWorktime(long long id_)
+    int WorktimeTable::updateWorktime(long long id_, const std::source_location& location_)
     {
+        const CallSiteScope call_site(location_);
         WorktimeTable table;
         return table.usePlaceholderUniSql("UPDATE worktime SET WHERE id=?;", {
                                               {ColType::T_INTEGER, id_}
                                           });
     }
 
-    int WorktimeTable::selectWorktimeExistTaskFromPeriod(long long starting_at, long long finishing_at)
+    int WorktimeTable::selectWorktimeExistTaskFromPeriod(long long starting_at, long long finishing_at,
+                                                         const std::source_location& location_)
     {
+        const CallSiteScope call_site(location_);
         const int err = usePlaceholderUniSql(
             std::string(F_GANTT_TASKS_FROM_DURATION_SQL, SIZE_GANTT_TASKS_FROM_DURATION_SQL),
             {
@@ -914,25 +1769,57 @@ namespace core::db {
         return 0;
     }
 
+    int WorktimeTable::forEachRecord(const std::string& where_clause_, const std::vector<ColValue>& placeholder_value_,
+                                     const std::string& order_by_,
+                                     const std::function<bool(const Worktime&)>& on_record_, const size_t max_rows_,
+                                     const std::source_location& location_)
+    {
+        // 列の順序は_column_namesと同じ(id, task_id, starting_time, finishing_time, created_at, updated_at)
+        return selectEach(where_clause_, placeholder_value_, order_by_, [&on_record_](sqlite3_stmt* stmt_) {
+            return on_record_(Worktime(
+                sqlite3_column_int64(stmt_, 0),
+                sqlite3_column_int64(stmt_, 1),
+                sqlite3_column_int64(stmt_, 2),
+                sqlite3_column_int64(stmt_, 3),
+                sqlite3_column_int64(stmt_, 4),
+                sqlite3_column_int64(stmt_, 5)
+            ));
+        }, max_rows_, location_);
+    }
+
     void WorktimeTable::_mapper()
     {
         _keys.clear();
         _table.clear();
-        for (auto i : _data) {
-            _keys.emplace_back(getLongLong(i.at("id")));
+        // 列番号は行ごとに引かず、最初に一度だけ解決する。
+        const int col_id = _data.columnIndex("id");
+        const int col_task_id = _data.columnIndex("task_id");
+        const int col_starting_time = _data.columnIndex("starting_time");
+        const int col_finishing_time = _data.columnIndex("finishing_time");
+        const int col_created_at = _data.columnIndex("created_at");
+        const int col_updated_at = _data.columnIndex("updated_at");
+        _keys.reserve(_data.rowCount());
+        _table.reserve(_data.rowCount());
+        for (size_t row = 0; row < _data.rowCount(); row++) {
+            const long long id = _data.getLongLong(row, col_id);
+            _keys.emplace_back(id);
             _table.try_emplace(
-                getLongLong(i.at("id")),
+                id,
                 Worktime({
-                    getLongLong(i.at("id")),
-                    getLongLong(i.at("task_id")),
-                    getLongLong(i.at("starting_time")),
-                    getLongLong(i.at("finishing_time")),
-                    getLongLong(i.at("created_at")),
-                    getLongLong(i.at("updated_at"))
+                    id,
+                    _data.getLongLong(row, col_task_id),
+                    _data.getLongLong(row, col_starting_time),
+                    _data.getLongLong(row, col_finishing_time),
+                    _data.getLongLong(row, col_created_at),
+                    _data.getLongLong(row, col_updated_at)
                 }));
         }
     }
 
     std::unique_ptr<DBManager> DBManager::_manager{nullptr};
+    std::atomic<size_t> DBManager::_query_log_sampling{1};
+    std::atomic<long long> DBManager::_slow_query_threshold_ms{0};
+    std::atomic<size_t> DBManager::_query_log_counter{0};
+    std::atomic<unsigned long long> DBManager::_connection_generation{0};
     std::filesystem::path DBManager::_db_file_path{util::getDataPath("db.sqlite")};
 } // core
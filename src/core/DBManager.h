@@ -31,10 +31,16 @@
 
 #ifndef DBMANAGER_H
 #define DBMANAGER_H
+#include <atomic>
 #include <filesystem>
 #include <format>
+#include <functional>
+#include <list>
 #include <memory>
+#include <optional>
+#include <source_location>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <variant>
@@ -56,10 +62,6 @@ namespace core::db {
 
     using ColValue = std::pair<ColType, std::variant<double, long long, std::string, std::nullptr_t>>;
 
-    using RowHash = std::unordered_map<std::string, ColValue>;
-
-    using Table = std::vector<RowHash>;
-
     namespace sqliteDeleter {
         struct DatabaseCloser {
             void operator()(sqlite3* db_) const;
@@ -98,6 +100,221 @@ namespace core::db {
      */
     std::string getString(const ColValue& value_, const std::string& default_value_ = "");
 
+    /**
+     * @brief ステートメントのplaceholderに、先頭から順に値をbindします。
+     * @param stmt_ bind対象のステートメント
+     * @param values_ placeholderと対応した値のリスト
+     * @return 正常終了時は0を返します。0以外を返す場合、`getPrefixedErrorCode(sqlite_error, BIND_ERROR)`によって求められたエラーコードです。
+     */
+    int bindValues(sqlite3_stmt* stmt_, const std::vector<ColValue>& values_);
+
+    /**
+     * @brief クエリの結果を保持するテーブルです。値は行優先の平坦なバッファに格納され、インデックスでアクセスします。
+     * @details 列名はステートメントごとに1度だけ保持されます。
+     * @details TEXT型の値は単一の文字列バッファに連結して保持するため、行や値ごとのメモリ確保は発生しません。
+     * @note 範囲外の行・列を指定した場合は、NULLとして扱われます。
+     */
+    class ResultSet final {
+    public:
+        /**
+         * @brief 列情報と値を全て破棄します。
+         */
+        void clear();
+
+        /**
+         * @brief ステートメントの列情報を設定します。この際、保持している値は破棄されます。
+         * @param stmt_ 列情報の取得元となるステートメント
+         */
+        void setColumns(sqlite3_stmt* stmt_);
+
+        /**
+         * @brief ステートメントの現在の行を末尾に追加します。setColumns()の後に呼び出してください。
+         * @param stmt_ sqlite3_step()がSQLITE_ROWを返したステートメント
+         */
+        void appendRow(sqlite3_stmt* stmt_);
+
+        [[nodiscard]] bool empty() const;
+
+        [[nodiscard]] size_t rowCount() const;
+
+        [[nodiscard]] size_t columnCount() const;
+
+        [[nodiscard]] const std::vector<std::string>& getColumnNames() const;
+
+        /**
+         * @brief 列名から列のインデックスを取得します。
+         * @param column_name_ 列名
+         * @return 列のインデックス。存在しない場合は-1
+         */
+        [[nodiscard]] int columnIndex(std::string_view column_name_) const;
+
+        [[nodiscard]] ColType getType(size_t row_, int col_) const;
+
+        /**
+         * @brief 値を取得します。
+         * @param row_ 行のインデックス
+         * @param col_ 列のインデックス
+         * @param default_value_ 保有している値が関数の戻り値の型と異なる場合に使用されます。
+         * @return 取得した値又はdefault_value_
+         */
+        [[nodiscard]] double getDouble(size_t row_, int col_, double default_value_ = 0.0) const;
+
+        /**
+         * @brief getDouble()を参照してください。
+         */
+        [[nodiscard]] long long getLongLong(size_t row_, int col_, long long default_value_ = 0) const;
+
+        /**
+         * @brief getDouble()を参照してください。
+         * @note 戻り値は、ResultSetが変更されるまで有効です。
+         */
+        [[nodiscard]] std::string_view getStringView(size_t row_, int col_, std::string_view default_value_ = "") const;
+
+        /**
+         * @brief getDouble()を参照してください。
+         */
+        [[nodiscard]] std::string getString(size_t row_, int col_, const std::string& default_value_ = "") const;
+
+        /**
+         * @brief 値をColValueとして取得します。
+         */
+        [[nodiscard]] ColValue getValue(size_t row_, int col_) const;
+
+    private:
+        struct TextRange {
+            size_t offset;
+            size_t length;
+        };
+
+        struct Cell {
+            ColType type;
+
+            union {
+                double real;
+                long long integer;
+                TextRange text;
+            };
+        };
+
+        [[nodiscard]] const Cell* _cell(size_t row_, int col_) const;
+
+        std::vector<std::string> _column_names;
+        std::vector<Cell> _cells;
+        std::string _text_buffer;
+    };
+
+    /**
+     * @brief 結果行を1行ずつ受け取るコールバックです。
+     * @details 引数のステートメントは、sqlite3_step()がSQLITE_ROWを返した直後の状態です。sqlite3_column_XXX()で値を読み取ってください。
+     * @details falseを返すと、残りの行を読み取らずに終了します。
+     * @note ステートメントは呼び出し中のみ有効です。ポインタを保持しないでください。
+     */
+    using RowCallback = std::function<bool(sqlite3_stmt*)>;
+
+    /**
+     * @brief SQL文をキーとして準備済みステートメントを保持する、容量制限付きのキャッシュです。
+     * @details 容量を超えた場合は、最も長く使用されていないステートメントから破棄されます。
+     * @details 取得したステートメントは、使用後にsqlite3_reset()とsqlite3_clear_bindings()を呼び出してください。
+     */
+    class StatementCache final {
+    public:
+        explicit StatementCache(size_t capacity_);
+
+        /**
+         * @brief キャッシュからステートメントを取得します。
+         * @param sql_ 準備時に使用したsql文
+         * @param sql_remaining_ 準備時にsql_のうち実行されなかった部分の文字列
+         * @return キャッシュされたステートメント。存在しない場合はnullptr
+         */
+        sqlite3_stmt* find(const std::string& sql_, std::string& sql_remaining_);
+
+        /**
+         * @brief ステートメントをキャッシュに登録します。所有権はキャッシュに移ります。
+         * @param sql_ 準備時に使用したsql文
+         * @param stmt_ 登録するステートメント
+         * @param sql_remaining_ 準備時にsql_のうち実行されなかった部分の文字列
+         * @return 登録したステートメント
+         */
+        sqlite3_stmt* insert(const std::string& sql_, sqlite3_stmt* stmt_, const std::string& sql_remaining_);
+
+        /**
+         * @brief 全てのステートメントを破棄します。スキーマの変更時や接続を閉じる前に呼び出してください。
+         */
+        void clear();
+
+        [[nodiscard]] size_t size() const;
+
+        /**
+         * @brief ステートメントがQueryPlanAuditorの監査を通過済みかを返します。
+         * @details find()またはinsert()の直後に呼び出してください。対象は最も最近使用されたステートメントのみです。
+         * @param stmt_ find()またはinsert()で取得したステートメント
+         */
+        [[nodiscard]] bool isAuditPassed(const sqlite3_stmt* stmt_) const;
+
+        /**
+         * @brief ステートメントを監査済みとして記録します。以降の実行では監査(ロックとsql文のコピー)を省略できます。
+         * @details find()またはinsert()の直後に呼び出してください。対象は最も最近使用されたステートメントのみです。
+         * @param stmt_ find()またはinsert()で取得したステートメント
+         */
+        void markAuditPassed(const sqlite3_stmt* stmt_);
+
+    private:
+        struct Entry {
+            std::string sql;
+            std::unique_ptr<sqlite3_stmt, sqliteDeleter::StatementFinalizer> stmt;
+            std::string sql_remaining;
+            // QueryPlanAuditorの監査を通過済みか
+            bool audit_passed{false};
+        };
+
+        size_t _capacity;
+        // 先頭が最も最近使用されたステートメント
+        std::list<Entry> _entries;
+        std::unordered_map<std::string_view, std::list<Entry>::iterator> _index;
+    };
+
+    /**
+     * @brief 読み取り専用のデータベース接続です。DBManager::ReadScopeにより、スレッドごとに1つ作成されます。
+     * @details SQLITE_OPEN_NOMUTEXで開かれるため、作成したスレッド以外から使用しないでください。
+     */
+    class ReadConnection final {
+    public:
+        ReadConnection() = default;
+
+        ReadConnection(const ReadConnection&) = delete;
+
+        ReadConnection& operator=(const ReadConnection&) = delete;
+
+        ~ReadConnection();
+
+        /**
+         * @brief データベースを読み取り専用で開きます。既に開かれている場合は、閉じてから開き直します。
+         * @param db_file_ 接続したいデータベースファイル
+         * @param generation_ 書き込み用の接続の世代。書き込み用の接続が開き直された場合に、この接続も開き直すために使用します。
+         * @return DBManager::getPrefixedErrorCode()に従ったエラーを返します。
+         */
+        int open(const std::string& db_file_, unsigned long long generation_);
+
+        /**
+         * @brief 接続を閉じます。準備済みステートメントは、接続より先に破棄されます。
+         */
+        void close();
+
+        [[nodiscard]] bool isOpen() const;
+
+        [[nodiscard]] unsigned long long getGeneration() const;
+
+        [[nodiscard]] sqlite3* get() const;
+
+        StatementCache& getStatementCache();
+
+    private:
+        std::unique_ptr<sqlite3, sqliteDeleter::DatabaseCloser> _db{nullptr, sqliteDeleter::DatabaseCloser()};
+        // _dbより先に破棄されるように、_dbの後に宣言する。
+        StatementCache _statement_cache{32};
+        unsigned long long _generation{0};
+    };
+
     /**
      * @brief データベース接続を管理し、SQL文を実行します。
      */
@@ -136,16 +353,91 @@ namespace core::db {
          * @brief 先頭のsql文を実行します。その際、binder_コールバックによりプレースホルダを利用できます。
          * @details この関数に無効なsql文が渡され、sqlite3_prepare_v2()による、準備済みステートメントがnullptrである場合はEND_OF_STATEMENTを返します。
          * @param sql_ sql文
-         * @param result_table_ 値を格納する対象のテーブル。emplace_backにより要素が追加されます。
+         * @param result_table_ 値を格納する対象のテーブル。select文が成功した場合、内容は置き換えられます。
          * @param binder_ placeholderをバインドするためのコールバック (prepareの実行直後に呼び出されます。)
          * @param binder_arg_ binderの第一引数
          * @param sql_remaining_ sql_のうち実行されなかった部分の文字列
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
          * @return 戻り値については、openDB()を参照してください。
          */
         static int usePlaceholderUniSql(const std::string& sql_,
-                                        Table& result_table_,
+                                        ResultSet& result_table_,
                                         int (*binder_)(void*, sqlite3_stmt*), void* binder_arg_,
-                                        std::string& sql_remaining_);
+                                        std::string& sql_remaining_,
+                                        const std::source_location& location_ = std::source_location::current());
+
+        /**
+         * @brief 先頭のsql文を実行し、結果を1行ずつon_row_に渡します。結果はメモリ上に保持されないため、行数に関わらず一定のメモリで処理できます。
+         * @details on_row_がfalseを返した場合は、その時点で正常終了(0)します。
+         * @details max_rows_に1以上を指定した場合、それを超える行が存在すれば、残りを読み取らずにROW_LIMIT_REACHEDを返します。
+         * @param sql_ sql文
+         * @param binder_ placeholderをバインドするためのコールバック (prepareの実行直後に呼び出されます。)
+         * @param binder_arg_ binderの第一引数
+         * @param on_row_ 各行で呼び出されるコールバック
+         * @param max_rows_ on_row_に渡す最大の行数。0の場合は制限しません。
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
+         * @return 戻り値については、openDB()を参照してください。
+         * @note on_row_はデータベースのロックを保持したまま呼び出されます。on_row_内でDBManagerを使用しないでください。
+         */
+        static int forEachRow(const std::string& sql_,
+                              int (*binder_)(void*, sqlite3_stmt*), void* binder_arg_,
+                              const RowCallback& on_row_, size_t max_rows_ = 0,
+                              const std::source_location& location_ = std::source_location::current());
+
+        /**
+         * @brief fn_を1つのトランザクションとして実行します。fn_が0以外を返した場合や例外を送出した場合は、ロールバックします。
+         * @details 入れ子で呼び出された場合は、SAVEPOINTにより内側のみをロールバックできます。
+         * @details トランザクションの間、他のスレッドからのデータベース操作は待機します。
+         * @param fn_ トランザクション内で実行する処理。正常終了時は0を返してください。
+         * @return fn_が0以外を返した場合はその値を返します。それ以外の戻り値については、openDB()を参照してください。
+         */
+        static int transaction(const std::function<int()>& fn_);
+
+        /**
+         * @brief 1つの準備済みステートメントを、値の組を差し替えながら繰り返し実行します。全体は1つのトランザクションで実行されます。
+         * @details いずれかの組で失敗した場合は、全体をロールバックします。
+         * @param sql_ 実行するINSERT文やUPDATE文 (1文のみ)
+         * @param parameter_sets_ placeholderに埋め込む値の組のリスト
+         * @return 戻り値については、transaction()を参照してください。
+         */
+        static int executeBatch(const std::string& sql_, const std::vector<std::vector<ColValue>>& parameter_sets_);
+
+        /**
+         * @brief スコープの間、このスレッドからの読み取りを、スレッド専用の読み取り接続で実行します。
+         * @details WALモードでは、読み取り接続は書き込み用の接続やほかのスレッドを待機しません。バックグラウンドでの読み込みに使用してください。
+         * @details スコープ全体が1つの読み取りトランザクションとなるため、スコープ内の複数の読み取りは同じ時点の状態を参照します。
+         * @details 書き込みを行う文、およびtransaction()の内部で実行される文は、従来通り書き込み用の接続で実行されます。
+         * @note 入れ子にした場合は、最も外側のスコープの読み取りトランザクションを共有します。
+         */
+        class ReadScope final {
+        public:
+            ReadScope();
+
+            ReadScope(const ReadScope&) = delete;
+
+            ReadScope& operator=(const ReadScope&) = delete;
+
+            ~ReadScope();
+
+        private:
+            // 読み取りトランザクションを開始したスコープであればtrue
+            bool _is_owner{false};
+        };
+
+        /**
+         * @brief スコープの間、このスレッドからの読み取りを、ReadScopeの内部であっても書き込み用の接続で実行します。
+         * @details ReadScopeのスナップショットではなく最新の状態を読み取る必要がある場合(キャッシュの読み込みなど)に使用します。
+         */
+        class LatestReadScope final {
+        public:
+            LatestReadScope();
+
+            LatestReadScope(const LatestReadScope&) = delete;
+
+            LatestReadScope& operator=(const LatestReadScope&) = delete;
+
+            ~LatestReadScope();
+        };
 
         /**
          * @details FIRST_ENUM 先頭の値 - 1
@@ -161,6 +453,8 @@ namespace core::db {
          * @details CLOSE_ERROR DBを閉じられませんでした。
          * @details DB_NOT_OPEN DBは開かれていません。
          * @details END_OF_STATEMENT 処理可能なsql文はありません。
+         * @details ROW_LIMIT_REACHED 行数の上限に達したため、残りの行を読み取らずに終了しました。
+         * @details NOT_READ_ONLY 読み取り接続では実行できない文です。(書き込み用の接続で再実行されます。)
          * @details LAST_ENUM ErrorPrefixの数を求めるためのenum
          */
         enum class ErrorPrefix {
@@ -176,6 +470,8 @@ namespace core::db {
             CLOSE_ERROR,
             DB_NOT_OPEN,
             END_OF_STATEMENT,
+            ROW_LIMIT_REACHED,
+            NOT_READ_ONLY,
             LAST_ENUM
         };
 
@@ -209,6 +505,29 @@ namespace core::db {
          */
         static int ReinitializeDB();
 
+        /**
+         * @brief 準備済みステートメントのキャッシュを破棄します。
+         * @details スキーマを変更するsql文は自動的にキャッシュを破棄するため、通常は呼び出す必要はありません。
+         */
+        static void clearStatementCache();
+
+        /**
+         * @brief クエリのデバッグログをN件に1件だけ出力するように設定します。
+         * @param sample_every_ 出力する間隔。0または1の場合は全てのクエリを出力します。
+         */
+        static void setQueryLogSampling(size_t sample_every_);
+
+        /**
+         * @brief 実行時間が閾値以上のクエリを、ログレベルに関わらずWARNINGとして出力するように設定します。
+         * @param threshold_ 閾値。0以下の場合は無効になります。
+         */
+        static void setSlowQueryThreshold(std::chrono::milliseconds threshold_);
+
+        /**
+         * @brief SettingsStoreのスナップショットから、クエリログのサンプリング間隔と低速クエリの閾値を適用します。
+         */
+        static void loadQueryLogSettings();
+
     private:
         /**
          * @brief error_pref_がErrorPrefixの範囲内か確認します。
@@ -228,25 +547,73 @@ namespace core::db {
          * @brief 先頭のsql文を実行します。その際、binder_コールバックによりプレースホルダを利用できます。
          * @details この関数に無効なsql文が渡され、sqlite3_prepare_v2()による、準備済みステートメントがnullptrである場合はEND_OF_STATEMENTを返します。
          * @param sql_ sql文
-         * @param result_table_ 値を格納する対象のテーブル。emplace_backにより要素が追加されます。
+         * @param result_table_ 値を格納する対象のテーブル。select文が成功した場合、内容は置き換えられます。
          * @param binder_ placeholderをバインドするためのコールバック (prepareの実行直後に呼び出されます。)
          * @param binder_arg_ binderの第一引数
          * @param sql_remaining_ sql_のうち実行されなかった部分の文字列
          * @return 戻り値については、openDB()を参照してください。
          */
         int _usePlaceholderUniSql(const std::string& sql_,
-                                  Table& result_table_,
+                                  ResultSet& result_table_,
                                   int (*binder_)(void*, sqlite3_stmt*), void* binder_arg_,
                                   std::string& sql_remaining_);
 
         /**
          * @brief この関数は、_usePlaceholderUniSql()のロジックです。_interface_mtxをロックしない場合には、呼び出さないでください。
+         * @param use_cache_ falseの場合、ステートメントキャッシュを使用しません。(複数文からなるsqlの実行時など)
+         * @param reader_ 使用する読み取り接続。nullptrの場合は書き込み用の接続を使用します。
          * @note 引数や戻り値の詳細は_usePlaceholderUniSql()を確認してください。
          */
-        int _usePlaceholderUniSqlInternal(std::string sql_,
-                                          Table& result_table_,
+        int _usePlaceholderUniSqlInternal(const std::string& sql_,
+                                          ResultSet& result_table_,
                                           int (*binder_)(void*, sqlite3_stmt*), void* binder_arg_,
-                                          std::string& sql_remaining_);
+                                          std::string& sql_remaining_, bool use_cache_ = true,
+                                          ReadConnection* reader_ = nullptr);
+
+        /**
+         * @brief ステートメントを準備して実行し、取得した行をon_row_に渡します。_usePlaceholderUniSqlInternal()とforEachRow()の共通のロジックです。
+         * @details 書き込み用の接続を使用する場合は、_interface_mtxをロックしない場合には、呼び出さないでください。
+         * @details reader_を指定した場合、読み取り専用でない文はNOT_READ_ONLYを返し、実行しません。
+         * @param on_columns_ select文の実行に成功した場合に、最初の行を渡す前に呼び出されます。(nullptrの場合は呼び出されません。)
+         * @param on_row_ 各行で呼び出されるコールバック
+         * @param max_rows_ on_row_に渡す最大の行数。0の場合は制限しません。
+         * @param reader_ 使用する読み取り接続。nullptrの場合は書き込み用の接続を使用します。
+         * @note その他の引数や戻り値の詳細は_usePlaceholderUniSql()、forEachRow()を確認してください。
+         */
+        int _stepStatementInternal(std::string sql_,
+                                   int (*binder_)(void*, sqlite3_stmt*), void* binder_arg_,
+                                   std::string& sql_remaining_, bool use_cache_,
+                                   const std::function<void(sqlite3_stmt*)>& on_columns_,
+                                   const RowCallback& on_row_, size_t max_rows_,
+                                   ReadConnection* reader_ = nullptr);
+
+        /**
+         * @brief ステートメントをキャッシュから取得するか、新たに準備します。書き込み用の接続を使用する場合は、_internal_mtxをロックした状態で呼び出してください。
+         * @param sql_ sql文
+         * @param sql_remaining_ sql_のうち準備されなかった部分の文字列
+         * @param use_cache_ falseの場合、ステートメントキャッシュを使用しません。
+         * @param uncached_stmt_ キャッシュされないステートメントの場合、その所有権が格納されます。
+         * @param stmt_ 準備されたステートメント
+         * @param reader_ 使用する読み取り接続。nullptrの場合は書き込み用の接続を使用します。
+         * @return 戻り値については、openDB()を参照してください。
+         */
+        int _prepareStatementInternal(const std::string& sql_, std::string& sql_remaining_, bool use_cache_,
+                                      std::unique_ptr<sqlite3_stmt, sqliteDeleter::StatementFinalizer>& uncached_stmt_,
+                                      sqlite3_stmt*& stmt_, ReadConnection* reader_ = nullptr);
+
+        /**
+         * @brief BEGINやCOMMITなどのトランザクション制御文を実行します。_interface_mtxをロックした状態で呼び出してください。
+         * @param sql_ 実行するsql文
+         * @return 戻り値については、openDB()を参照してください。
+         */
+        int _executeControlInternal(const std::string& sql_);
+
+        /**
+         * @brief sql文がスキーマを変更するもの(CREATE, DROP, ALTER)か判定します。
+         * @param stmt_ 判定対象のステートメント
+         * @return スキーマを変更するsql文であればtrue
+         */
+        static bool _isSchemaStatement(sqlite3_stmt* stmt_);
 
         /**
          * @brief データベース`db_file_`を開きます。
@@ -271,23 +638,48 @@ namespace core::db {
         [[nodiscard]] int _initializeDB();
 
         /**
-         *
-         * @param start_query_at_ クエリの実行開始時間
-         * @param sql_ 実行されたsql文
+         * @brief クエリをログに出力し、QueryStatsに記録します。sqlの展開や整形は、出力が必要な場合にのみ行います。
+         * @details log_query_がtrueであればDEBUGレベルで、実行時間が閾値以上であればWARNINGレベルで出力します。
+         * @param stmt_ 実行されたステートメント (sqlite3_reset()前であること)
+         * @param start_query_at_ クエリの実行開始時間。計測していない場合は既定値(エポック)を渡します。
+         * @param log_query_ DEBUGレベルで出力する対象か
          * @param success_ クエリは成功した？
          * @param is_selected trueであれば、選択クエリ、falseなら更新クエリとして扱います。
          * @param rows_count_ is_selectedがtrueなら選択された行数。そうでないなら、変更された行数。
          */
-        static void _queryLogger(std::chrono::time_point<std::chrono::high_resolution_clock> start_query_at_,
-                                 const std::string& sql_, bool success_, bool is_selected, size_t rows_count_);
+        static void _queryLogger(sqlite3_stmt* stmt_,
+                                 std::chrono::time_point<std::chrono::high_resolution_clock> start_query_at_,
+                                 bool log_query_, bool success_, bool is_selected, size_t rows_count_);
+
+        /**
+         * @brief 次のクエリをデバッグログに出力するか判定します。
+         * @details 報告者DBManagerのDEBUGレベルが無効であれば、常にfalseを返します。有効であれば、サンプリングの間隔に従います。
+         */
+        static bool _isQueryLogTarget();
+
+        /**
+         * @brief このスレッドで使用すべき読み取り接続を取得します。
+         * @return ReadScopeの内部であり、かつtransaction()の内部でなければ読み取り接続。それ以外はnullptr
+         */
+        static ReadConnection* _activeReadConnection();
 
         static std::unique_ptr<char, sqliteDeleter::SqliteStringDeleter> sqlite3ExpandedSqlWrapper(sqlite3_stmt* stmt_);
 
         std::unique_ptr<sqlite3, sqliteDeleter::DatabaseCloser> _db{nullptr, sqliteDeleter::DatabaseCloser()};
+        // _dbより先に破棄されるように、_dbの後に宣言する。
+        StatementCache _statement_cache{64};
         static std::unique_ptr<DBManager> _manager;
         static std::filesystem::path _db_file_path;
+        static std::atomic<size_t> _query_log_sampling;
+        static std::atomic<long long> _slow_query_threshold_ms;
+        static std::atomic<size_t> _query_log_counter;
+        // 書き込み用の接続を閉じるたびに増加する。読み取り接続はこの値が変わった場合に開き直される。
+        static std::atomic<unsigned long long> _connection_generation;
         std::mutex _internal_mtx;
-        std::mutex _interface_mtx;
+        // トランザクション中に同じスレッドから再びロックできるよう、再帰ミューテックスとする。
+        std::recursive_mutex _interface_mtx;
+        // 現在のトランザクションの入れ子の深さ (_interface_mtxにより保護される)
+        int _transaction_depth{0};
     };
 
     class DatabaseTable {
@@ -308,16 +700,19 @@ namespace core::db {
          * @param sql_ 実行したいsql文 (1文のみ)
          * @param placeholder_value_ プレースホルダの値
          * @param sql_remaining_ SQL文の実行されなかった部分
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
          * @return 正常終了時は0を返します。0以外を返す場合、`getPrefixedErrorCode(sqlite_error, error_pos)`によって求められたエラーコードです。
          */
         int usePlaceholderUniSql(const std::string& sql_, std::vector<ColValue> placeholder_value_,
-                                 std::string& sql_remaining_);
+                                 std::string& sql_remaining_,
+                                 const std::source_location& location_ = std::source_location::current());
 
         /**
          * @brief 単一のSQL文を実行します。usePlaceholderUniSql(sql_, {}, std::string())のエイリアスです。
          * @note 詳細はusePlaceholderUniSql(sql_, placeholder_value_, sql_remaining_)を参照してください。
          */
-        int usePlaceholderUniSql(const std::string& sql_, std::vector<ColValue> placeholder_value_ = {});
+        int usePlaceholderUniSql(const std::string& sql_, std::vector<ColValue> placeholder_value_ = {},
+                                 const std::source_location& location_ = std::source_location::current());
 
         /**
          * @brief FROM句以降のsqlを指定し実行します。この関数では_mapper()が呼び出されます。JOINやUNIONを扱うためのものです。
@@ -325,13 +720,14 @@ namespace core::db {
          * @note 残りの説明は、usePlaceholderUniSql(sql_, placeholder_value_, sql_remaining_)を参照してください。
          * @return
          */
-        int columnTableConfiguredSql(const std::string& sql_, std::vector<ColValue> placeholder_value_ = {});
+        int columnTableConfiguredSql(const std::string& sql_, std::vector<ColValue> placeholder_value_ = {},
+                                     const std::source_location& location_ = std::source_location::current());
 
         /**
          * @brief 全てのレコードを取得します。
          * @return 正常終了時は0を返します。0以外を返す場合、`getPrefixedErrorCode(sqlite_error, error_pos)`によって求められたエラーコードです。
          */
-        int selectRecords();
+        int selectRecords(const std::source_location& location_ = std::source_location::current());
 
         /**
          * @brief 1つのselect文を実行し、メンバ変数_dataを更新する(結果はgetTable()によって取得できる)。その際、placeholderを使用する。
@@ -341,7 +737,8 @@ namespace core::db {
          * @return 正常終了時は0を返します。0以外を返す場合、`getPrefixedErrorCode(sqlite_error, error_pos)`によって求められたエラーコードです。
          */
         int selectRecords(const std::string& where_clause_,
-                          const std::vector<ColValue>& placeholder_value_, const std::string& order_by_ = "");
+                          const std::vector<ColValue>& placeholder_value_, const std::string& order_by_ = "",
+                          const std::source_location& location_ = std::source_location::current());
 
         /**
          * @brief 1つのselect文を実行し、メンバ変数_dataを更新する(結果はgetTable()によって取得できる)。その際、placeholderを使用する。
@@ -353,13 +750,28 @@ namespace core::db {
          * @return 正常終了時は0を返します。0以外を返す場合、`getPrefixedErrorCode(sqlite_error, error_pos)`によって求められたエラーコードです。
          */
         int selectRecords(const std::string& where_clause_, const std::vector<ColValue>& placeholder_value_,
-                          const std::string& order_by_, int limit_, int offset_);
+                          const std::string& order_by_, int limit_, int offset_,
+                          const std::source_location& location_ = std::source_location::current());
+
+        /**
+         * @brief selectRecords()と同じ条件でレコードを取得し、_dataに格納せずに1行ずつon_row_に渡します。
+         * @details 列の順序は、getColumnNames()の順序と一致します。_mapper()は呼び出されません。
+         * @param where_clause_ WHERE句の後の条件文 (空文字の場合は全てのレコード)
+         * @param placeholder_value_ 条件文のplaceholder(?)に埋め込む値
+         * @param order_by_ ORDER BY句の後の条件文
+         * @param on_row_ 各行で呼び出されるコールバック。falseを返すと終了します。
+         * @param max_rows_ on_row_に渡す最大の行数。0の場合は制限しません。
+         * @return 戻り値については、DBManager::forEachRow()を参照してください。
+         */
+        int selectEach(const std::string& where_clause_, const std::vector<ColValue>& placeholder_value_,
+                       const std::string& order_by_, const RowCallback& on_row_, size_t max_rows_ = 0,
+                       const std::source_location& location_ = std::source_location::current());
 
         /**
          * @brief 生のテーブルを取得します。
          * @return 直前に取得されたテーブル。
          */
-        const Table& getRawTable();
+        const ResultSet& getRawTable();
 
         /**
          * @brief 列名を取得します。
@@ -392,7 +804,7 @@ namespace core::db {
 
         std::string _table_name;
 
-        Table _data;
+        ResultSet _data;
     };
 
     enum class Status {
@@ -421,6 +833,7 @@ namespace core::db {
         const long long updated_at;
 
         friend class TaskTable;
+        friend class TaskTreeCache;
 
     private:
         Task();
@@ -435,6 +848,63 @@ namespace core::db {
         );
     };
 
+    /**
+     * @brief 子タスクの一覧における並び順のキーです。(status_id, name, id)の順に比較します。
+     * @details キーセットページングで、ページの先頭・末尾の位置を表すために使用します。
+     */
+    struct TaskPageKey {
+        long long status_id{0};
+        std::string name{};
+        long long id{0};
+    };
+
+    /**
+     * @brief 子タスクのページの取得方法です。
+     */
+    enum class TaskPageSeek {
+        // 先頭からoffset_件を読み飛ばした位置から取得します。
+        OFFSET,
+        // キーより後ろのタスクを取得します。
+        AFTER,
+        // キーより前のタスクを取得します。
+        BEFORE,
+    };
+
+    /**
+     * @brief 子タスクのページと同時に取得する、親タスク名と子タスクの総数です。
+     */
+    struct ChildTaskPage {
+        std::string parent_name{};
+        long long total_count{0};
+    };
+
+    /**
+     * @brief タスクが属するページと、ページ内での位置です。
+     */
+    struct TaskLocation {
+        // タスクの親タスクID。親タスクがない場合は0です。
+        long long parent_id{0};
+        // 1から始まるページ番号
+        long long page_num{0};
+        // 0から始まるページ内での位置
+        long long page_pos{0};
+        ChildTaskPage page{};
+    };
+
+    /**
+     * @brief タスクの詳細画面に表示する、ある時点のタスクと作業時間です。
+     */
+    struct TaskDetailSnapshot {
+        // タスクの行。タスクが存在しない場合はstd::nulloptです。
+        std::optional<Task> task{};
+        // タスク自身の合計作業時間
+        std::chrono::seconds task_worktime{0};
+        // 子孫を含めた合計作業時間
+        std::chrono::seconds subtree_worktime{0};
+        // アクティブタスクが、このタスク自身またはその子孫であればtrue
+        bool is_active_task_family{false};
+    };
+
     class TaskTable final : public DatabaseTable {
     public:
         TaskTable();
@@ -448,56 +918,151 @@ namespace core::db {
          * @param status_filter_ 対象のステータスID。列挙型Statusと対応しています。Statusに存在しない値が指定された場合は絞り込まれません。
          * @param page_ 対象のページ。負の数を指定した場合には、ページングされません。
          * @param per_page_ 1ページ当たりのアイテム数。負の数を指定した場合には、ページングされません。
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
          * @return <成功ステータス, 親タスク名> 成功ステータスで0以外の値が返った場合、エラーが発生しています。
          */
         std::pair<int, std::string> fetchChildTasks(long long parent_task_id_, int status_filter_, int page_ = -1,
-                                                    int per_page_ = -1);
+                                                    int per_page_ = -1,
+                                                    const std::source_location& location_ = std::source_location::current());
+
+        /**
+         * @brief 子タスクの1ページ分と、親タスク名・子タスクの総数を1つの文で取得します。
+         * @details (parent_id, status_id, name, id)のインデックスを使用します。
+         * AFTER・BEFOREではキーの位置からインデックスを検索するため、ページの位置に関わらず一定の時間で取得できます。
+         * 子タスクの総数はtask_child_countから求めるため、子タスクの数に依存しません。
+         * 取得したタスクは、getKeys()で(status_id, name, id)の昇順に並びます。
+         * @param parent_task_id_ 対象の親タスクID。0以下の値が指定された場合、NULLとして扱います。
+         * @param status_filter_ 対象のステータスID。列挙型Statusに存在しない値が指定された場合は絞り込まれません。
+         * @param per_page_ 1ページ当たりのアイテム数
+         * @param seek_ ページの取得方法
+         * @param key_ AFTER・BEFOREで基準となるキー
+         * @param offset_ OFFSETで読み飛ばす件数
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
+         * @return <成功ステータス, 親タスク名と子タスクの総数> 成功ステータスで0以外の値が返った場合、エラーが発生しています。
+         */
+        std::pair<int, ChildTaskPage> fetchChildTaskPage(long long parent_task_id_, int status_filter_, int per_page_,
+                                                         TaskPageSeek seek_, const TaskPageKey& key_ = {},
+                                                         long long offset_ = 0,
+                                                         const std::source_location& location_ = std::source_location::current());
+
+        /**
+         * @brief getKeys()のpos_番目のタスクの並び順のキーを取得します。
+         */
+        [[nodiscard]] TaskPageKey getPageKey(size_t pos_) const;
 
         /**
          * @brief 親タスク・ステータスで絞り込んだ子タスクの数を取得する。
+         * @details トリガーにより更新されるtask_child_countを検索するため、子タスクの数に依存しません。
          * @param parent_task_id_ 対象の親タスクID。0以下の値が指定された場合、NULLとして扱います。
          * @param filter_status_ 対象のステータスID。列挙型Statusと対応しています。Statusに存在しない値が指定された場合は絞り込まれません。
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
          * @return <成功ステータス, タスクの数> 成功ステータスで0以外の値が返った場合、エラーが発生しています。
          */
-        static std::pair<int, long long> countChildTasks(long long parent_task_id_, int filter_status_);
+        static std::pair<int, long long> countChildTasks(long long parent_task_id_, int filter_status_,
+                                                         const std::source_location& location_ = std::source_location::current());
+
+        /**
+         * @brief タスクが属するページを、ページ番号・ページ内での位置・親タスク名・子タスクの総数と共に1つの文で取得します。
+         * @details ページ内での順位は、(parent_id, status_id, name, id)のインデックスで対象より前の兄弟タスクを数えて求めます。
+         * ページの行は対象のタスクを基準に前後をキーで検索するため、OFFSETによる読み飛ばしは行いません。
+         * 取得したタスクは、getKeys()で(status_id, name, id)の昇順に並びます。
+         * @param task_id_ 対象のタスクID
+         * @param status_filter_ ステータスフィルタ。対象のタスクがフィルタに一致しない場合は見つからないものとして扱います。
+         * @param per_page_ 1ページ当たりのタスク数
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
+         * @return <成功ステータス, 位置> タスクが存在しない場合は-2を返します。
+         */
+        std::pair<int, TaskLocation> locateTask(long long task_id_, int status_filter_, int per_page_,
+                                                const std::source_location& location_ = std::source_location::current());
 
         /**
          * @brief ステータスフィルタ適用時にタスクIDが属するページ番号を取得します。
+         * @details 対象より前の兄弟タスクをインデックスで数え、ページ番号を求めます。
          * @param task_id_ タスクID
          * @param status_filter_ ステータスフィルタ
          * @param per_page_ 1ページ当たりのタスク数
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
          * @return <成功ステータス, <ページ番号, ページ内での位置>> 成功ステータスで0以外の値が返った場合、エラーが発生しています。
          */
         static std::pair<int, std::pair<long long, long long>> fetchPageNumAndFocusFromTask(
-            long long task_id_, int status_filter_, int per_page_);
+            long long task_id_, int status_filter_, int per_page_,
+            const std::source_location& location_ = std::source_location::current());
 
         /**
          * @brief タスクIDから単一のタスクを取得します。
          * @param task_id_ 対象となるタスクID
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
          * @return <成功ステータス, タスク> 成功ステータスで0以外の値が返った場合、エラーが発生しています。
          */
-        static std::pair<int, Task> fetchTask(long long task_id_);
+        static std::pair<int, Task> fetchTask(long long task_id_,
+                                              const std::source_location& location_ = std::source_location::current());
 
         /**
-         * @brief 合計作業時間を取得します。
+         * @brief 子孫を含めた合計作業時間を取得します。
+         * @details トリガーにより更新されるtask_worktime_totalを1行検索するのみです。
          * @param task_id_ 取得対象のタスクID
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
          * @return <成功ステータス, 作業時間(秒)> 成功ステータスで0以外の値が返った場合、エラーが発生しています。
+         * @note 終了していない作業時間は含まれません。計測中の時間は、呼び出し元で加算してください。
          */
-        static std::pair<int, std::chrono::seconds> computeTotalWorktime(long long task_id_);
+        static std::pair<int, std::chrono::seconds> computeTotalWorktime(long long task_id_,
+                                                                         const std::source_location& location_ = std::source_location::current());
 
-        static std::pair<int, std::chrono::seconds> fetchWorktime(long long task_id_);
+        /**
+         * @brief タスク自身の合計作業時間を取得します。子孫の作業時間は含みません。
+         * @note 終了していない作業時間は含まれません。計測中の時間は、呼び出し元で加算してください。
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
+         */
+        static std::pair<int, std::chrono::seconds> fetchWorktime(long long task_id_,
+                                                                  const std::source_location& location_ = std::source_location::current());
 
-        static std::pair<int, Task> fetchLastTask(long long parent_id);
+        static std::pair<int, Task> fetchLastTask(long long parent_id,
+                                                  const std::source_location& location_ = std::source_location::current());
 
-        static int newTask(long long parent_id);
+        static int newTask(long long parent_id,
+                           const std::source_location& location_ = std::source_location::current());
+
+        static int deleteTask(long long task_id,
+                              const std::source_location& location_ = std::source_location::current());
+
+        /**
+         * @brief sibling_task_idが、parent_idのタスク自身またはその子孫か判定します。
+         * @details task_closureの主キーを1度検索するのみです。
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
+         */
+        static bool computeIsSiblings(long long sibling_task_id, long long parent_id,
+                                      const std::source_location& location_ = std::source_location::current());
 
-        static int deleteTask(long long task_id);
+        /**
+         * @brief タスクの行・タスク自身の作業時間・子孫を含めた作業時間・アクティブタスクとの関係を1つの文で取得します。
+         * @details task・task_worktime_total・task_closureをそれぞれ主キーで1度ずつ検索するのみです。
+         * computeTotalWorktime()・fetchWorktime()・computeIsSiblings()を個別に呼び出す場合と同じ値を返します。
+         * @param task_id_ 対象のタスクID
+         * @param active_task_id_ アクティブタスクのID。アクティブタスクがない場合は0以下の値を指定します。
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
+         * @return <成功ステータス, スナップショット> タスクが存在しない場合は-2を返します。
+         * @note 終了していない作業時間は含まれません。計測中の時間は、呼び出し元で加算してください。
+         */
+        static std::pair<int, TaskDetailSnapshot> fetchDetailSnapshot(long long task_id_, long long active_task_id_,
+                                                                      const std::source_location& location_ = std::source_location::current());
 
-        static bool computeIsSiblings(long long sibling_task_id, long long parent_id);
+        friend class TaskTreeCache;
 
     private:
         void _mapper() override;
 
+        /**
+         * @brief _keysを(status_id, name, id)の昇順に並べ替えます。
+         */
+        void _sortKeysByPageOrder();
+
+        /**
+         * @brief 並び順で、taskがtargetに対してoperator_の関係にある兄弟タスクの条件を返します。
+         * @param is_filtered_ ステータスで絞り込む場合はtrue。targetと同じステータスのタスクのみを対象とします。
+         * @param operator_ 比較演算子
+         */
+        static std::string _siblingOrderCondition(bool is_filtered_, std::string_view operator_);
+
         std::unordered_map<long long, Task> _table;
         std::vector<long long> _keys;
     };
@@ -507,6 +1072,9 @@ namespace core::db {
         const long long id;
         const long long task_id;
         const long long starting_time;
+        /**
+         * @brief 作業の終了時刻です。終了していない作業時間では0になります。
+         */
         const long long finishing_time;
         const long long created_at;
         const long long updated_at;
@@ -532,17 +1100,46 @@ namespace core::db {
 
         const std::vector<long long>& getKeys() const;
 
-        static int ensureOnlyOneActiveTask();
+        /**
+         * @brief 終了していない作業時間のうち、最新の1件以外を終了します。
+         * @details 終了していない作業時間はidx_worktime_active(部分インデックス)のみを走査します。
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
+         */
+        static int ensureOnlyOneActiveTask(const std::source_location& location_ = std::source_location::current());
 
-        static int deactivateAllTasks();
+        /**
+         * @brief 終了していない作業時間をすべて終了します。
+         * @details idx_worktime_activeのみを走査するため、作業時間の総数に依存しません。
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
+         */
+        static int deactivateAllTasks(const std::source_location& location_ = std::source_location::current());
+
+        /**
+         * @brief 終了していない作業時間のうち、最新の1件を取得します。
+         * @details idx_worktime_activeの末尾を1件読み取るのみです。finishing_timeは0になります。
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
+         */
+        int selectActiveTask(const std::source_location& location_ = std::source_location::current());
 
-        int selectActiveTask();
+        static int activateTask(long long task_id_,
+                                const std::source_location& location_ = std::source_location::current());
 
-        static int activateTask(long long task_id_);
+        static int updateWorktime(long long id_,
+                                  const std::source_location& location_ = std::source_location::current());
 
-        static int updateWorktime(long long id_);
+        int selectWorktimeExistTaskFromPeriod(long long starting_at, long long finishing_at,
+                                              const std::source_location& location_ = std::source_location::current());
 
-        int selectWorktimeExistTaskFromPeriod(long long starting_at, long long finishing_at);
+        /**
+         * @brief 条件に一致する作業時間を、_dataに格納せずに1件ずつon_record_に渡します。
+         * @details 引数の詳細は、DatabaseTable::selectEach()を参照してください。
+         * @param on_record_ 各レコードで呼び出されるコールバック。falseを返すと終了します。
+         * @param location_ 呼び出し元。QueryPlanAuditorの報告に使用します。
+         */
+        int forEachRecord(const std::string& where_clause_, const std::vector<ColValue>& placeholder_value_,
+                          const std::string& order_by_, const std::function<bool(const Worktime&)>& on_record_,
+                          size_t max_rows_ = 0,
+                          const std::source_location& location_ = std::source_location::current());
 
     private:
         void _mapper() override;
@@ -22,22 +22,41 @@
 
 #include "DBMigrator.h"
 
+#include <format>
+
+#include "Logger.h"
+
 void core::db::DBMigrator::migrate()
 {
     NoMappingTable tbl{};
     tbl.usePlaceholderUniSql("SELECT 1 FROM pragma_table_info('migrate') LIMIT 1;");
-    if (tbl.getRawTable().empty()) { DBManager::execute(std::string(F_MIG_V1_SQL, SIZE_MIG_V1_SQL)); }
+    if (tbl.getRawTable().empty()) {
+        DBManager::transaction([] { return DBManager::execute(std::string(F_MIG_V1_SQL, SIZE_MIG_V1_SQL)); });
+    }
 
     tbl.usePlaceholderUniSql("SELECT 1 AS id, MAX(applied) AS applied FROM migrate;");
     long long latest_applied = 0;
     if (!tbl.getRawTable().empty())
-        latest_applied = getLongLong(tbl.getRawTable().front().at("applied"));
+        latest_applied = tbl.getRawTable().getLongLong(0, tbl.getRawTable().columnIndex("applied"));
     while (latest_applied < stoll(std::string(F_MIGRATE_LATEST_, SIZE_MIGRATE_LATEST_))) {
-        DBManager::execute(_migration_sql.at(latest_applied));
+        // 途中で失敗したマイグレーションが部分的に適用されないよう、1つのトランザクションで実行する。
+        if (const int err = DBManager::transaction([&] {
+            return DBManager::execute(_migration_sql.at(latest_applied));
+        }); err != 0) {
+            Logger::error(std::format("failed to apply migration v{}. ({})", latest_applied + 1, err), "DBMigrator");
+            break;
+        }
         latest_applied++;
     }
 }
 
 std::vector<std::string> core::db::DBMigrator::_migration_sql{
-    std::string(F_MIG_V1_SQL, SIZE_MIG_V1_SQL)
+    std::string(F_MIG_V1_SQL, SIZE_MIG_V1_SQL),
+    std::string(F_MIG_V2_SQL, SIZE_MIG_V2_SQL),
+    std::string(F_MIG_V3_SQL, SIZE_MIG_V3_SQL),
+    std::string(F_MIG_V4_SQL, SIZE_MIG_V4_SQL),
+    std::string(F_MIG_V5_SQL, SIZE_MIG_V5_SQL),
+    std::string(F_MIG_V6_SQL, SIZE_MIG_V6_SQL),
+    std::string(F_MIG_V7_SQL, SIZE_MIG_V7_SQL),
+    std::string(F_MIG_V8_SQL, SIZE_MIG_V8_SQL)
 };
@@ -0,0 +1,208 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "DBPerformanceProfile.h"
+
+#include <algorithm>
+#include <format>
+#include <unordered_map>
+
+#include "DBManager.h"
+#include "Logger.h"
+
+namespace core::db {
+    namespace {
+        const std::string journal_mode_key = "journal mode";
+        const std::string synchronous_key = "synchronous";
+        const std::string cache_size_key = "cache size (KiB)";
+        const std::string mmap_size_key = "mmap size (MiB)";
+        const std::string temp_store_key = "temp store";
+        const std::string busy_timeout_key = "busy timeout (ms)";
+
+        /**
+         * @brief 設定キーと選択肢の対応表。PRAGMAにはプレースホルダが使用できないため、文字列値はこの中の値のみを許可する。
+         */
+        const std::unordered_map<std::string, std::vector<std::string>> selections{
+            {journal_mode_key, {"wal", "delete", "truncate", "persist"}},
+            {synchronous_key, {"off", "normal", "full", "extra"}},
+            {cache_size_key, {"2000", "8192", "32768", "65536"}},
+            {mmap_size_key, {"0", "64", "256"}},
+            {temp_store_key, {"memory", "file", "default"}},
+            {busy_timeout_key, {"0", "1000", "5000", "10000"}},
+        };
+
+        /**
+         * @brief 数値の設定値の上限。
+         */
+        const std::unordered_map<std::string, long long> numeric_max{
+            {cache_size_key, 1024 * 1024},
+            {mmap_size_key, 4096},
+            {busy_timeout_key, 10 * 60 * 1000},
+        };
+
+        /**
+         * @brief 文字列の設定値を検証します。選択肢にない値の場合は既定値のまま変更しません。
+         */
+        void validateText(const std::string& setting_key_, const std::string& value_, std::string& target_)
+        {
+            if (const auto& list = selections.at(setting_key_); std::ranges::find(list, value_) != list.end()) {
+                target_ = value_;
+                return;
+            }
+            Logger::warning(std::format("invalid value '{}' for '{}'. use default '{}'.", value_, setting_key_,
+                                        target_), "DBPerformanceProfile");
+        }
+
+        /**
+         * @brief 数値の設定値を検証します。数値でない、または範囲外の場合は既定値のまま変更しません。
+         */
+        void validateNumber(const std::string& setting_key_, const std::string& value_, long long& target_)
+        {
+            try {
+                size_t pos = 0;
+                if (const long long number = std::stoll(value_, &pos);
+                    pos == value_.size() && number >= 0 && number <= numeric_max.at(setting_key_)) {
+                    target_ = number;
+                    return;
+                }
+            }
+            catch (std::exception&) {
+                // 数値に変換できない場合は、下で既定値を使用する旨を出力する。
+            }
+            Logger::warning(std::format("invalid value '{}' for '{}'. use default '{}'.", value_, setting_key_,
+                                        target_), "DBPerformanceProfile");
+        }
+    }
+
+    DBPerformanceProfile::Values DBPerformanceProfile::load()
+    {
+        Values values{};
+        SettingTable tbl{};
+        std::vector<ColValue> placeholder_values;
+        std::string condition;
+        for (const auto& key : getSettingKeys()) {
+            if (!condition.empty()) condition += ", ";
+            condition += "?";
+            placeholder_values.emplace_back(ColType::T_TEXT, key);
+        }
+        if (tbl.selectRecords(std::format("setting_key IN ({})", condition), placeholder_values) != 0) return values;
+        for (const auto& id : tbl.getKeys()) {
+            const Setting& setting = tbl.getTable().at(id);
+            if (setting.setting_key == journal_mode_key) validateText(journal_mode_key, setting.value,
+                                                                      values.journal_mode);
+            else if (setting.setting_key == synchronous_key) validateText(synchronous_key, setting.value,
+                                                                          values.synchronous);
+            else if (setting.setting_key == cache_size_key) validateNumber(cache_size_key, setting.value,
+                                                                           values.cache_size_kib);
+            else if (setting.setting_key == mmap_size_key) validateNumber(mmap_size_key, setting.value,
+                                                                          values.mmap_size_mib);
+            else if (setting.setting_key == temp_store_key) validateText(temp_store_key, setting.value,
+                                                                         values.temp_store);
+            else if (setting.setting_key == busy_timeout_key) validateNumber(busy_timeout_key, setting.value,
+                                                                             values.busy_timeout_ms);
+        }
+        return values;
+    }
+
+    int DBPerformanceProfile::apply()
+    {
+        const Values values = load();
+        // 値は全てload()で検証済みのため、そのままsql文に埋め込む。
+        // cache_sizeは負の値を指定すると、ページ数ではなくKiB単位になる。
+        const std::string sql = std::format(
+            "PRAGMA journal_mode = {};\n"
+            "PRAGMA synchronous = {};\n"
+            "PRAGMA cache_size = -{};\n"
+            "PRAGMA mmap_size = {};\n"
+            "PRAGMA temp_store = {};\n"
+            "PRAGMA busy_timeout = {};",
+            values.journal_mode,
+            values.synchronous,
+            values.cache_size_kib,
+            values.mmap_size_mib * 1024 * 1024,
+            values.temp_store,
+            values.busy_timeout_ms);
+        if (const int err = DBManager::execute(sql); err != 0) {
+            Logger::error(std::format("failed to apply performance profile. ({})", err), "DBPerformanceProfile");
+            return err;
+        }
+        {
+            std::lock_guard lock(_applied_values_mtx);
+            _applied_values = values;
+        }
+        _reportEffectiveValues();
+        return 0;
+    }
+
+    std::string DBPerformanceProfile::buildReadConnectionSql()
+    {
+        Values values;
+        {
+            std::lock_guard lock(_applied_values_mtx);
+            values = _applied_values;
+        }
+        return std::format(
+            "PRAGMA cache_size = -{};\n"
+            "PRAGMA mmap_size = {};\n"
+            "PRAGMA temp_store = {};\n"
+            "PRAGMA busy_timeout = {};",
+            values.cache_size_kib,
+            values.mmap_size_mib * 1024 * 1024,
+            values.temp_store,
+            values.busy_timeout_ms);
+    }
+
+    std::vector<std::string> DBPerformanceProfile::getSelections(const std::string& setting_key_)
+    {
+        if (!selections.contains(setting_key_)) return {};
+        return selections.at(setting_key_);
+    }
+
+    const std::vector<std::string>& DBPerformanceProfile::getSettingKeys()
+    {
+        static const std::vector<std::string> keys{
+            journal_mode_key, synchronous_key, cache_size_key, mmap_size_key, temp_store_key, busy_timeout_key
+        };
+        return keys;
+    }
+
+    void DBPerformanceProfile::_reportEffectiveValues()
+    {
+        std::string report;
+        for (const std::string pragma : {
+                 "journal_mode", "synchronous", "cache_size", "mmap_size", "temp_store", "busy_timeout"
+             }) {
+            std::string value = "unknown";
+            DBManager::forEachRow(std::format("PRAGMA {};", pragma), nullptr, nullptr, [&value](sqlite3_stmt* stmt_) {
+                if (const auto text = sqlite3_column_text(stmt_, 0); text != nullptr)
+                    value = reinterpret_cast<const char*>(text);
+                return false;
+            });
+            if (!report.empty()) report += ", ";
+            report += std::format("{}={}", pragma, value);
+        }
+        Logger::info(std::format("effective performance profile: {}", report), "DBPerformanceProfile");
+    }
+
+    DBPerformanceProfile::Values DBPerformanceProfile::_applied_values{};
+    std::mutex DBPerformanceProfile::_applied_values_mtx{};
+} // core::db
@@ -0,0 +1,102 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/**
+ * @file DBPerformanceProfile.h
+ * @date 26/10/16
+ * @brief データベース接続に適用するPRAGMA設定(パフォーマンスプロファイル)
+ * @details 設定値はsettingsテーブルに保存され、接続を開いた際と設定の変更時に適用されます。
+ * @author saku shirakura (saku@sakushira.com)
+ */
+
+
+#ifndef DBPERFORMANCEPROFILE_H
+#define DBPERFORMANCEPROFILE_H
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace core::db {
+    /**
+     * @brief settingsテーブルに保存されたパフォーマンスプロファイルを読み込み、データベース接続に適用します。
+     * @details 不正な設定値は既定値に置き換えられ、その旨がログに出力されます。
+     */
+    class DBPerformanceProfile {
+    public:
+        /**
+         * @brief プロファイルの設定値です。数値はそれぞれのメンバ名に示す単位で保持します。
+         */
+        struct Values {
+            std::string journal_mode{"wal"};
+            std::string synchronous{"normal"};
+            long long cache_size_kib{8192};
+            long long mmap_size_mib{64};
+            std::string temp_store{"memory"};
+            long long busy_timeout_ms{5000};
+        };
+
+        /**
+         * @brief settingsテーブルから設定値を読み込み、検証します。
+         * @return 検証済みの設定値。設定が存在しないか不正な場合、その項目は既定値になります。
+         */
+        static Values load();
+
+        /**
+         * @brief 設定値を読み込み、データベース接続に適用します。適用後の実際の値をログに出力します。
+         * @return 正常終了時は0を返します。0以外を返す場合、`getPrefixedErrorCode(sqlite_error, error_pos)`によって求められたエラーコードです。
+         */
+        static int apply();
+
+        /**
+         * @brief 読み取り接続に適用するPRAGMA文を、最後にapply()で適用した設定値から生成します。
+         * @details 書き込み用の接続を使用しないため、トランザクション中でも待機しません。
+         * @details journal_modeとsynchronousは書き込み用の接続でのみ意味を持つため、含みません。
+         * @return 実行するsql文
+         */
+        static std::string buildReadConnectionSql();
+
+        /**
+         * @brief 設定画面で選択できる値の一覧を返します。
+         * @param setting_key_ プロファイルの設定キー
+         * @return 選択肢の一覧。プロファイルの設定キーでない場合は空です。
+         */
+        static std::vector<std::string> getSelections(const std::string& setting_key_);
+
+        /**
+         * @brief プロファイルの設定キーの一覧を返します。
+         */
+        static const std::vector<std::string>& getSettingKeys();
+
+    private:
+        /**
+         * @brief 現在の接続に適用されている値を問い合わせ、ログに出力します。
+         */
+        static void _reportEffectiveValues();
+
+        // 最後にapply()で適用した設定値
+        static Values _applied_values;
+        static std::mutex _applied_values_mtx;
+    };
+} // core::db
+
+#endif //DBPERFORMANCEPROFILE_H
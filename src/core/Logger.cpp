@@ -23,9 +23,10 @@
 #include "Logger.h"
 #include <chrono>
 #include <format>
+#include <system_error>
 #include <sqlite3.h>
 
-#include "DBManager.h"
+#include "SettingsStore.h"
 
 constexpr size_t rotate_count = 5;
 constexpr size_t max_log_size = 1 * 1024 * 1024;
@@ -37,7 +38,7 @@ void Logger::log(const std::string& msg_, const std::string& log_level_, const s
 {
     try {
         std::lock_guard lock(_mtx);
-        if (_log_level_map.contains(log_level_) && _log_level_map.at(log_level_) < log_level) return;
+        if (_log_level_map.contains(log_level_) && _log_level_map.at(log_level_) < _thresholdOf(reporter_)) return;
         if (!_ensureOpenLogFile()) {
             _success_prev_logging = false;
             return;
@@ -77,6 +78,43 @@ void Logger::sqliteLoggingCallback([[maybe_unused]] void* pArg, int iErrCode, co
 
 bool Logger::isSuccessPrevLogging() { return _success_prev_logging; }
 
+bool Logger::isEnabled(const LogLevel level_, const std::string& reporter_) noexcept
+{
+    try {
+        std::lock_guard lock(_mtx);
+        return level_ >= _thresholdOf(reporter_);
+    }
+    catch (const std::system_error&) {
+        return false;
+    }
+}
+
+bool Logger::isQueryLogEnabled(const LogLevel level_) noexcept
+{
+    return static_cast<int>(level_) >= _query_log_threshold.load(std::memory_order_relaxed);
+}
+
+void Logger::setLogLevel(const LogLevel level_)
+{
+    std::lock_guard lock(_mtx);
+    log_level = level_;
+    _refreshQueryLogThresholdLocked();
+}
+
+void Logger::setReporterLogLevel(const std::string& reporter_, const LogLevel level_)
+{
+    std::lock_guard lock(_mtx);
+    _reporter_log_level.insert_or_assign(reporter_, level_);
+    _refreshQueryLogThresholdLocked();
+}
+
+void Logger::resetReporterLogLevel(const std::string& reporter_)
+{
+    std::lock_guard lock(_mtx);
+    _reporter_log_level.erase(reporter_);
+    _refreshQueryLogThresholdLocked();
+}
+
 void Logger::updateLogLevelLabel(const std::string& label_, LogLevel level_)
 {
     if (label_.empty()) return;
@@ -94,15 +132,13 @@ void Logger::setLogFilePath(const std::string& log_file_path_)
 
 void Logger::loadFromSettings()
 {
-    core::db::SettingTable tbl{};
-    tbl.selectRecords("setting_key = 'log level'", {});
-    if (tbl.getKeys().empty()) return;
-    const std::string level = tbl.getTable().at(tbl.getKeys().front()).value;
-    if (level == "debug") log_level = LogLevel::DEBUG;
-    else if (level == "info") log_level = LogLevel::INFO;
-    else if (level == "warning") log_level = LogLevel::WARNING;
-    else if (level == "error") log_level = LogLevel::ERROR;
-    else if (level == "critical") log_level = LogLevel::CRITICAL;
+    const auto settings = core::SettingsStore::snapshot();
+    if (!settings->log_level.has_value()) return;
+    setLogLevel(*settings->log_level);
+
+    // クエリログ(報告者: DBManager)のログレベル
+    if (settings->query_log_level.has_value()) setReporterLogLevel("DBManager", *settings->query_log_level);
+    else resetReporterLogLevel("DBManager");
 }
 
 Logger::LogLevel Logger::log_level = LogLevel::INFO;
@@ -116,6 +152,22 @@ std::unordered_map<std::string, Logger::LogLevel> Logger::_log_level_map{
     {"NOTE", LogLevel::INFO}
 };
 
+std::unordered_map<std::string, Logger::LogLevel> Logger::_reporter_log_level{};
+
+std::atomic<int> Logger::_query_log_threshold{static_cast<int>(LogLevel::INFO)};
+
+Logger::LogLevel Logger::_thresholdOf(const std::string& reporter_)
+{
+    if (const auto found = _reporter_log_level.find(reporter_); found != _reporter_log_level.end())
+        return found->second;
+    return log_level;
+}
+
+void Logger::_refreshQueryLogThresholdLocked()
+{
+    _query_log_threshold.store(static_cast<int>(_thresholdOf(QUERY_LOG_REPORTER)), std::memory_order_relaxed);
+}
+
 void Logger::_rotate()
 {
     std::error_code err;
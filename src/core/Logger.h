@@ -31,6 +31,7 @@
 
 #ifndef LOGGER_H
 #define LOGGER_H
+#include <atomic>
 #include <fstream>
 #include <mutex>
 #include <string>
@@ -83,15 +84,70 @@ public:
 
     static bool isSuccessPrevLogging();
 
+    /**
+     * @brief reporter_がlevel_のログを出力するか判定します。
+     * @details ログメッセージの組み立てにコストがかかる場合、事前にこの関数で判定することで、出力されないメッセージの生成を省略できます。
+     * @param level_ 判定するログレベル
+     * @param reporter_ ログの報告者。setReporterLogLevel()で個別のレベルが設定されていれば、そのレベルで判定します。
+     * @return 出力される場合はtrue
+     */
+    static bool isEnabled(LogLevel level_, const std::string& reporter_ = "") noexcept;
+
+    /**
+     * @brief クエリログ(報告者: DBManager)がlevel_のログを出力するか判定します。
+     * @details 全てのクエリの実行時に呼び出されるため、ロックを取らずにキャッシュ済みのログレベルで判定します。
+     * @param level_ 判定するログレベル
+     * @return 出力される場合はtrue
+     */
+    static bool isQueryLogEnabled(LogLevel level_) noexcept;
+
+    /**
+     * @brief 全体のログレベルを設定します。
+     * @note log_levelを直接変更した場合、isQueryLogEnabled()にはsetReporterLogLevel()などの次の呼び出しまで反映されません。
+     */
+    static void setLogLevel(LogLevel level_);
+
+    /**
+     * @brief 報告者ごとに、全体のログレベル(log_level)とは異なるログレベルを設定します。
+     * @param reporter_ ログの報告者
+     * @param level_ reporter_に適用するログレベル
+     */
+    static void setReporterLogLevel(const std::string& reporter_, LogLevel level_);
+
+    /**
+     * @brief setReporterLogLevel()による設定を解除し、reporter_に全体のログレベルを適用します。
+     * @param reporter_ ログの報告者
+     */
+    static void resetReporterLogLevel(const std::string& reporter_);
+
     static void updateLogLevelLabel(const std::string& label_, LogLevel level_);
 
     static void setLogFilePath(const std::string& log_file_path_);
 
+    /**
+     * @brief SettingsStoreのスナップショットから、全体のログレベルとクエリログのログレベルを適用します。
+     */
     static void loadFromSettings();
 
     static LogLevel log_level;
 private:
     static std::unordered_map<std::string, LogLevel> _log_level_map;
+    static std::unordered_map<std::string, LogLevel> _reporter_log_level;
+
+    /**
+     * @brief reporter_に適用されるログレベルを返します。_mtxをロックした状態で呼び出してください。
+     */
+    static LogLevel _thresholdOf(const std::string& reporter_);
+
+    /**
+     * @brief クエリログに適用されるログレベルを_query_log_thresholdに反映します。_mtxをロックした状態で呼び出してください。
+     */
+    static void _refreshQueryLogThresholdLocked();
+
+    // クエリログの報告者
+    static constexpr auto QUERY_LOG_REPORTER = "DBManager";
+    // クエリログに適用されるログレベル(LogLevelの値)
+    static std::atomic<int> _query_log_threshold;
 
     /**
      * @brief ログローテーションを実行します。
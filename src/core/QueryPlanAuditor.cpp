@@ -0,0 +1,177 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "QueryPlanAuditor.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <memory>
+#include <ranges>
+
+#include "DBManager.h"
+#include "Logger.h"
+
+namespace core::db {
+    namespace {
+        // 全件走査を問題とするテーブル
+        const std::vector<std::string> audited_tables{"task", "worktime", "schedule"};
+
+        bool isAuditedScan(const std::string_view detail_)
+        {
+            constexpr std::string_view scan_prefix = "SCAN ";
+            if (!detail_.starts_with(scan_prefix)) return false;
+            const std::string_view target = detail_.substr(scan_prefix.size());
+            return std::ranges::any_of(audited_tables, [target](const std::string& table_) {
+                return target.starts_with(table_) &&
+                    (target.size() == table_.size() || target[table_.size()] == ' ');
+            });
+        }
+
+        // 走査しても問題としないインデックス
+        // idx_worktime_activeは未終了の作業時間のみを含む部分インデックスで、ensureOnlyOneActiveTask()により高々1行に保たれる。
+        const std::vector<std::string> exempt_scan_indexes{"idx_worktime_active"};
+
+        // 件数が高々数行と分かっているインデックスによる走査かを判定する。
+        // 部分インデックスであっても件数は条件次第のため、一律には除外しない。
+        bool isExemptIndexScan(const std::string_view detail_)
+        {
+            constexpr std::string_view index_marker = "INDEX ";
+            const size_t marker_pos = detail_.find(index_marker);
+            if (marker_pos == std::string_view::npos) return false;
+            const std::string_view rest = detail_.substr(marker_pos + index_marker.size());
+            const std::string_view index_name = rest.substr(0, rest.find(' '));
+            return std::ranges::find(exempt_scan_indexes, index_name) != exempt_scan_indexes.end();
+        }
+    }
+
+    bool QueryPlanAuditor::inspect(sqlite3* db_, sqlite3_stmt* stmt_, const std::source_location* location_)
+    {
+        if (!isEnabled() || db_ == nullptr || stmt_ == nullptr) return false;
+        const char* raw_sql = sqlite3_sql(stmt_);
+        if (raw_sql == nullptr) return false;
+        const std::string sql = raw_sql;
+        std::lock_guard lock(_mtx);
+        // キャッシュから破棄され、再度準備された文は監査をやり直さない。
+        if (_passed.contains(sql)) return true;
+        auto found = _findings.find(sql);
+        if (found == _findings.end()) {
+            std::vector<std::string> issues = _findIssues(db_, sql);
+            if (issues.empty()) {
+                _passed.insert(sql);
+                return true;
+            }
+            std::string summary;
+            for (const auto& issue : issues) summary += std::format("\n  {}", issue);
+            Logger::warning(std::format("query plan issue at {}:\n{}{}", _formatCallSite(location_), sql, summary),
+                            "QueryPlanAuditor");
+            found = _findings.emplace(sql, Finding{sql, std::move(issues), 0, {}}).first;
+        }
+        found->second.executions++;
+        found->second.call_sites[_formatCallSite(location_)]++;
+        return false;
+    }
+
+    std::string QueryPlanAuditor::report()
+    {
+        std::vector<Finding> findings;
+        {
+            std::lock_guard lock(_mtx);
+            for (const auto& finding : _findings | std::views::values) findings.emplace_back(finding);
+        }
+        std::ranges::sort(findings, [](const Finding& a_, const Finding& b_) {
+            if (a_.executions != b_.executions) return a_.executions > b_.executions;
+            return a_.issues.size() > b_.issues.size();
+        });
+        std::string result = std::format("query plan audit: {} offending statements.", findings.size());
+        for (size_t i = 0; i < findings.size(); i++) {
+            const Finding& finding = findings.at(i);
+            result += std::format("\n#{} executed {} times\n  sql: {}", i + 1, finding.executions, finding.sql);
+            for (const auto& issue : finding.issues) result += std::format("\n  plan: {}", issue);
+            for (const auto& [call_site, count] : finding.call_sites) {
+                result += std::format("\n  from: {} ({} times)", call_site, count);
+            }
+        }
+        return result;
+    }
+
+    void QueryPlanAuditor::writeReport()
+    {
+        bool has_findings;
+        {
+            std::lock_guard lock(_mtx);
+            has_findings = !_findings.empty();
+        }
+        if (has_findings) Logger::warning(report(), "QueryPlanAuditor");
+        else Logger::info(report(), "QueryPlanAuditor");
+    }
+
+    void QueryPlanAuditor::clear()
+    {
+        std::lock_guard lock(_mtx);
+        _findings.clear();
+        _passed.clear();
+    }
+
+    void QueryPlanAuditor::setEnabled(const bool enabled_) { _enabled.store(enabled_, std::memory_order_relaxed); }
+
+    bool QueryPlanAuditor::isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+
+    std::vector<std::string> QueryPlanAuditor::_findIssues(sqlite3* db_, const std::string& sql_)
+    {
+        std::vector<std::string> issues;
+        // 空の文と、EXPLAIN文自体は監査しない。
+        const size_t keyword_begin = sql_.find_first_not_of(" \t\r\n");
+        if (keyword_begin == std::string::npos || sql_.compare(keyword_begin, 7, "EXPLAIN") == 0) return issues;
+        sqlite3_stmt* tmp_stmt = nullptr;
+        if (sqlite3_prepare_v2(db_, std::format("EXPLAIN QUERY PLAN {}", sql_).c_str(), -1, &tmp_stmt, nullptr)
+            != SQLITE_OK) {
+            sqliteDeleter::StatementFinalizer()(tmp_stmt);
+            return issues;
+        }
+        const std::unique_ptr<sqlite3_stmt, sqliteDeleter::StatementFinalizer> stmt(
+            tmp_stmt, sqliteDeleter::StatementFinalizer());
+        if (stmt == nullptr) return issues;
+        // 列は(id, parent, notused, detail)の順
+        while (sqlite3_step(stmt.get()) == SQLITE_ROW) {
+            const auto* detail_text = reinterpret_cast<const char*>(sqlite3_column_text(stmt.get(), 3));
+            if (detail_text == nullptr) continue;
+            const std::string_view detail = detail_text;
+            if ((isAuditedScan(detail) && !isExemptIndexScan(detail)) || detail.find("USE TEMP B-TREE") != std::string_view::npos) {
+                issues.emplace_back(detail);
+            }
+        }
+        return issues;
+    }
+
+    std::string QueryPlanAuditor::_formatCallSite(const std::source_location* location_)
+    {
+        if (location_ == nullptr) return "(unknown)";
+        return std::format("{}:{} ({})", std::filesystem::path(location_->file_name()).filename().string(),
+                           location_->line(), location_->function_name());
+    }
+
+    std::mutex QueryPlanAuditor::_mtx{};
+    std::unordered_map<std::string, QueryPlanAuditor::Finding> QueryPlanAuditor::_findings{};
+    std::unordered_set<std::string> QueryPlanAuditor::_passed{};
+    std::atomic<bool> QueryPlanAuditor::_enabled{false};
+} // core::db
@@ -0,0 +1,111 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/**
+ * @file QueryPlanAuditor.h
+ * @date 26/10/16
+ * @brief EXPLAIN QUERY PLANによるクエリプランの監査
+ * @details インデックスを使用できないクエリを、プランの劣化としてユーザーが気付く前に検出するためのデバッグ機能です。
+ * @author saku shirakura (saku@sakushira.com)
+ */
+
+
+#ifndef QUERYPLANAUDITOR_H
+#define QUERYPLANAUDITOR_H
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <source_location>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <sqlite3.h>
+
+
+namespace core::db {
+    /**
+     * @brief 各sql文の初回実行時にEXPLAIN QUERY PLANを実行し、問題のあるプランを記録します。
+     * @details task, worktime, scheduleテーブルに対するSCAN(全件走査)と、USE TEMP B-TREE(一時的なソート)を問題として扱います。
+     * ただし、idx_worktime_active(未終了の作業時間のみを含み、高々1行の部分インデックス)による走査は問題としません。
+     * @details 問題のある文は、以降の実行のたびに実行回数と呼び出し元を記録し、report()で実行回数の多い順に出力します。
+     * @note 監査はデバッグ用のため、有効な間はミューテックスによるロックを行います。
+     * 問題のなかった文はStatementCacheに印を付け、以降の実行ではロックを取りません。
+     */
+    class QueryPlanAuditor final {
+    public:
+        QueryPlanAuditor() = delete;
+
+        /**
+         * @brief ステートメントを監査します。初回はプランを確認し、2回目以降は問題のある文の実行回数と呼び出し元のみを記録します。
+         * @param db_ ステートメントを準備した接続 (EXPLAIN QUERY PLANの実行に使用します。)
+         * @param stmt_ 実行前のステートメント
+         * @param location_ 呼び出し元。不明な場合はnullptr
+         * @return プランに問題がなかった場合はtrue。呼び出し元はStatementCache::markAuditPassed()で記録し、以降の監査を省略してください。
+         */
+        static bool inspect(sqlite3* db_, sqlite3_stmt* stmt_, const std::source_location* location_);
+
+        /**
+         * @brief 問題のある文を、実行回数の多い順に並べた報告を作成します。
+         */
+        static std::string report();
+
+        /**
+         * @brief report()をログに出力します。問題のある文が存在する場合はWARNINGとして出力します。
+         */
+        static void writeReport();
+
+        /**
+         * @brief 記録を全て破棄します。
+         */
+        static void clear();
+
+        static void setEnabled(bool enabled_);
+
+        [[nodiscard]] static bool isEnabled();
+
+    private:
+        struct Finding {
+            std::string sql;
+            // 問題のあるプランの行 (例: "SCAN worktime")
+            std::vector<std::string> issues;
+            unsigned long long executions{0};
+            // 呼び出し元("ファイル名:行 (関数名)")ごとの実行回数
+            std::map<std::string, unsigned long long> call_sites;
+        };
+
+        /**
+         * @brief sql文のプランを取得し、問題のある行を返します。
+         */
+        static std::vector<std::string> _findIssues(sqlite3* db_, const std::string& sql_);
+
+        static std::string _formatCallSite(const std::source_location* location_);
+
+        static std::mutex _mtx;
+        static std::unordered_map<std::string, Finding> _findings;
+        // 監査済みで問題のなかったsql文
+        static std::unordered_set<std::string> _passed;
+        static std::atomic<bool> _enabled;
+    };
+} // core::db
+
+#endif //QUERYPLANAUDITOR_H
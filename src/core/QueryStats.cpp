@@ -0,0 +1,224 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "QueryStats.h"
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <format>
+
+namespace core::db {
+    namespace {
+        constexpr uint64_t fnv_offset_basis = 14695981039346656037ULL;
+        constexpr uint64_t fnv_prime = 1099511628211ULL;
+
+        bool isSpace(const char c_) { return std::isspace(static_cast<unsigned char>(c_)) != 0; }
+
+        /**
+         * @brief ヒストグラムのバケットiの上限をミリ秒で返します。
+         */
+        double bucketUpperBoundMs(const size_t bucket_)
+        {
+            return static_cast<double>(1ULL << (bucket_ + 1)) / 1000.0;
+        }
+    }
+
+    QueryStats::Slot::~Slot() { delete sql.load(); }
+
+    void QueryStats::record(sqlite3_stmt* stmt_, const std::chrono::nanoseconds elapsed_, const bool success_,
+                            const size_t rows_returned_, const size_t rows_changed_)
+    {
+        if (!isEnabled() || stmt_ == nullptr) return;
+        const char* sql = sqlite3_sql(stmt_);
+        Slot& slot = _findSlot(sql == nullptr ? "" : sql);
+        const uint64_t elapsed_ns = elapsed_.count() < 0 ? 0 : static_cast<uint64_t>(elapsed_.count());
+        const uint64_t elapsed_us = elapsed_ns / 1000;
+        const size_t bucket = std::min<size_t>(elapsed_us == 0 ? 0 : std::bit_width(elapsed_us) - 1,
+                                               HISTOGRAM_BUCKETS - 1);
+        slot.calls.fetch_add(1, std::memory_order_relaxed);
+        if (!success_) slot.failures.fetch_add(1, std::memory_order_relaxed);
+        slot.total_ns.fetch_add(elapsed_ns, std::memory_order_relaxed);
+        slot.rows_returned.fetch_add(rows_returned_, std::memory_order_relaxed);
+        slot.rows_changed.fetch_add(rows_changed_, std::memory_order_relaxed);
+        // 第3引数に1を指定し、次回の実行に備えてカウンタをリセットする。
+        slot.vm_steps.fetch_add(sqlite3_stmt_status(stmt_, SQLITE_STMTSTATUS_VM_STEP, 1),
+                                std::memory_order_relaxed);
+        slot.fullscan_steps.fetch_add(sqlite3_stmt_status(stmt_, SQLITE_STMTSTATUS_FULLSCAN_STEP, 1),
+                                      std::memory_order_relaxed);
+        slot.sorts.fetch_add(sqlite3_stmt_status(stmt_, SQLITE_STMTSTATUS_SORT, 1), std::memory_order_relaxed);
+        slot.histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::vector<QueryStats::Summary> QueryStats::collect()
+    {
+        std::vector<Summary> result;
+        for (const Slot& slot : _slots) {
+            const std::string* sql = slot.sql.load(std::memory_order_acquire);
+            if (sql == nullptr || slot.calls.load(std::memory_order_relaxed) == 0) continue;
+            result.emplace_back(_summarize(slot, *sql));
+        }
+        if (_overflow.calls.load(std::memory_order_relaxed) != 0) {
+            result.emplace_back(_summarize(_overflow, "(other statements)"));
+        }
+        std::ranges::sort(result, [](const Summary& a_, const Summary& b_) { return a_.total_ms > b_.total_ms; });
+        return result;
+    }
+
+    std::string QueryStats::format(const size_t limit_)
+    {
+        const std::vector<Summary> summaries = collect();
+        std::string result = std::format("{:>8} {:>6} {:>10} {:>9} {:>9} {:>9} {:>9} {:>9} {:>10} {:>10} {:>6}  {}\n",
+                                         "calls", "fail", "total ms", "mean ms", "p50 ms", "p99 ms", "rows",
+                                         "changed", "vm steps", "fullscan", "sorts", "sql");
+        size_t count = 0;
+        for (const auto& summary : summaries) {
+            if (limit_ != 0 && count++ >= limit_) break;
+            result += std::format(
+                "{:>8} {:>6} {:>10.3f} {:>9.3f} {:>9.3f} {:>9.3f} {:>9} {:>9} {:>10} {:>10} {:>6}  {}\n",
+                summary.calls, summary.failures, summary.total_ms, summary.mean_ms, summary.p50_ms, summary.p99_ms,
+                summary.rows_returned, summary.rows_changed, summary.vm_steps, summary.fullscan_steps, summary.sorts,
+                summary.sql);
+        }
+        return result;
+    }
+
+    void QueryStats::reset()
+    {
+        const auto reset_slot = [](Slot& slot_) {
+            slot_.calls.store(0, std::memory_order_relaxed);
+            slot_.failures.store(0, std::memory_order_relaxed);
+            slot_.total_ns.store(0, std::memory_order_relaxed);
+            slot_.rows_returned.store(0, std::memory_order_relaxed);
+            slot_.rows_changed.store(0, std::memory_order_relaxed);
+            slot_.vm_steps.store(0, std::memory_order_relaxed);
+            slot_.fullscan_steps.store(0, std::memory_order_relaxed);
+            slot_.sorts.store(0, std::memory_order_relaxed);
+            for (auto& bucket : slot_.histogram) bucket.store(0, std::memory_order_relaxed);
+        };
+        // スロットとsql文は、記録中のスレッドが参照している可能性があるため解放しない。
+        for (Slot& slot : _slots) reset_slot(slot);
+        reset_slot(_overflow);
+    }
+
+    void QueryStats::setEnabled(const bool enabled_) { _enabled.store(enabled_, std::memory_order_relaxed); }
+
+    bool QueryStats::isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+
+    uint64_t QueryStats::_hash(const std::string_view sql_)
+    {
+        uint64_t hash = fnv_offset_basis;
+        bool pending_space = false;
+        bool is_leading = true;
+        for (const char c : sql_) {
+            if (isSpace(c)) {
+                pending_space = !is_leading;
+                continue;
+            }
+            // 連続する空白は1つの空白として扱い、末尾の空白は無視する。
+            if (pending_space) {
+                hash = (hash ^ static_cast<unsigned char>(' ')) * fnv_prime;
+                pending_space = false;
+            }
+            hash = (hash ^ static_cast<unsigned char>(c)) * fnv_prime;
+            is_leading = false;
+        }
+        // 0は空きスロットを表すため使用しない。
+        return hash == 0 ? 1 : hash;
+    }
+
+    std::string QueryStats::_normalize(const std::string_view sql_)
+    {
+        std::string result;
+        result.reserve(sql_.size());
+        bool pending_space = false;
+        for (const char c : sql_) {
+            if (isSpace(c)) {
+                pending_space = !result.empty();
+                continue;
+            }
+            if (pending_space) {
+                result += ' ';
+                pending_space = false;
+            }
+            result += c;
+        }
+        return result;
+    }
+
+    QueryStats::Slot& QueryStats::_findSlot(const std::string_view sql_)
+    {
+        const uint64_t hash = _hash(sql_);
+        for (size_t i = 0; i < CAPACITY; i++) {
+            Slot& slot = _slots[(hash + i) % CAPACITY];
+            uint64_t current = slot.hash.load(std::memory_order_acquire);
+            if (current == hash) return slot;
+            if (current != 0) continue;
+            // 空きスロットを確保する。他のスレッドが先に確保した場合は、その値で判定し直す。
+            if (slot.hash.compare_exchange_strong(current, hash, std::memory_order_acq_rel)) {
+                slot.sql.store(new std::string(_normalize(sql_)), std::memory_order_release);
+                return slot;
+            }
+            if (current == hash) return slot;
+        }
+        return _overflow;
+    }
+
+    QueryStats::Summary QueryStats::_summarize(const Slot& slot_, std::string sql_)
+    {
+        Summary summary{};
+        summary.sql = std::move(sql_);
+        summary.calls = slot_.calls.load(std::memory_order_relaxed);
+        summary.failures = slot_.failures.load(std::memory_order_relaxed);
+        summary.total_ms = static_cast<double>(slot_.total_ns.load(std::memory_order_relaxed)) / 1000000.0;
+        summary.mean_ms = summary.calls == 0 ? 0 : summary.total_ms / static_cast<double>(summary.calls);
+        summary.rows_returned = slot_.rows_returned.load(std::memory_order_relaxed);
+        summary.rows_changed = slot_.rows_changed.load(std::memory_order_relaxed);
+        summary.vm_steps = slot_.vm_steps.load(std::memory_order_relaxed);
+        summary.fullscan_steps = slot_.fullscan_steps.load(std::memory_order_relaxed);
+        summary.sorts = slot_.sorts.load(std::memory_order_relaxed);
+        // ヒストグラムの合計は記録中の値を含まないよう、callsではなくバケットの合計を使用する。
+        std::array<uint64_t, HISTOGRAM_BUCKETS> histogram{};
+        uint64_t histogram_total = 0;
+        for (size_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+            histogram[i] = slot_.histogram[i].load(std::memory_order_relaxed);
+            histogram_total += histogram[i];
+        }
+        const auto percentile = [&histogram, histogram_total](const double ratio_) {
+            if (histogram_total == 0) return 0.0;
+            const auto target = static_cast<uint64_t>(static_cast<double>(histogram_total) * ratio_);
+            uint64_t cumulative = 0;
+            for (size_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+                cumulative += histogram[i];
+                if (cumulative > target || cumulative == histogram_total) return bucketUpperBoundMs(i);
+            }
+            return bucketUpperBoundMs(HISTOGRAM_BUCKETS - 1);
+        };
+        summary.p50_ms = percentile(0.50);
+        summary.p99_ms = percentile(0.99);
+        return summary;
+    }
+
+    std::array<QueryStats::Slot, QueryStats::CAPACITY> QueryStats::_slots{};
+    QueryStats::Slot QueryStats::_overflow{};
+    std::atomic<bool> QueryStats::_enabled{false};
+} // core::db
@@ -0,0 +1,158 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/**
+ * @file QueryStats.h
+ * @date 26/10/16
+ * @brief 正規化したsql文ごとのクエリ統計
+ * @details 統計は`--db-stats`オプションにより終了時に出力され、Diagnosticsページで確認できます。
+ * @author saku shirakura (saku@sakushira.com)
+ */
+
+
+#ifndef QUERYSTATS_H
+#define QUERYSTATS_H
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <sqlite3.h>
+
+
+namespace core::db {
+    /**
+     * @brief sql文ごとの実行回数、実行時間、行数、sqliteの内部カウンタを集計します。
+     * @details 集計表は固定長のオープンアドレス法によるハッシュ表で、記録はロックを取らずにatomic操作のみで行います。
+     * @details sql文は空白を1つにまとめて正規化します。プレースホルダを使用しているため、値の違いは同じ文として集計されます。
+     * @details 集計表が満杯になった場合、以降の新しい文は"(other statements)"にまとめて集計されます。
+     */
+    class QueryStats final {
+    public:
+        QueryStats() = delete;
+
+        /**
+         * @brief 1つのsql文の集計結果です。時間の単位はミリ秒です。
+         * @details p50とp99は、2の累乗のマイクロ秒で区切ったヒストグラムから求めた近似値(区間の上限)です。
+         */
+        struct Summary {
+            std::string sql;
+            uint64_t calls;
+            uint64_t failures;
+            double total_ms;
+            double mean_ms;
+            double p50_ms;
+            double p99_ms;
+            uint64_t rows_returned;
+            uint64_t rows_changed;
+            uint64_t vm_steps;
+            uint64_t fullscan_steps;
+            uint64_t sorts;
+        };
+
+        /**
+         * @brief 1回の実行を記録します。ステートメントの内部カウンタは読み取り後にリセットされます。
+         * @param stmt_ 実行されたステートメント (sqlite3_reset()前であること)
+         * @param elapsed_ 実行時間
+         * @param success_ 実行に成功した場合はtrue
+         * @param rows_returned_ 取得した行数
+         * @param rows_changed_ 変更された行数
+         */
+        static void record(sqlite3_stmt* stmt_, std::chrono::nanoseconds elapsed_, bool success_,
+                           size_t rows_returned_, size_t rows_changed_);
+
+        /**
+         * @brief 現在の集計結果を取得します。
+         * @return 合計実行時間の降順に並べた集計結果
+         */
+        static std::vector<Summary> collect();
+
+        /**
+         * @brief 集計結果を表形式の文字列にします。
+         * @param limit_ 出力する文の数。0の場合は全て出力します。
+         */
+        static std::string format(size_t limit_ = 0);
+
+        /**
+         * @brief 集計結果を0に戻します。
+         * @note 記録中のスレッドがある場合、その記録は一部のみ残ることがあります。
+         */
+        static void reset();
+
+        /**
+         * @brief 記録の有効・無効を設定します。既定では無効です。
+         * @details 有効な間は、全ての文の実行で時刻の取得と集計が行われます。計測が必要な場合のみ有効にしてください。
+         */
+        static void setEnabled(bool enabled_);
+
+        [[nodiscard]] static bool isEnabled();
+
+    private:
+        static constexpr size_t CAPACITY = 256;
+        static constexpr size_t HISTOGRAM_BUCKETS = 32;
+
+        struct Slot {
+            // 正規化したsql文のハッシュ値。0は空きを表す。
+            std::atomic<uint64_t> hash{0};
+            // スロットを確保したスレッドが設定するまではnullptr
+            std::atomic<std::string*> sql{nullptr};
+            std::atomic<uint64_t> calls{0};
+            std::atomic<uint64_t> failures{0};
+            std::atomic<uint64_t> total_ns{0};
+            std::atomic<uint64_t> rows_returned{0};
+            std::atomic<uint64_t> rows_changed{0};
+            std::atomic<uint64_t> vm_steps{0};
+            std::atomic<uint64_t> fullscan_steps{0};
+            std::atomic<uint64_t> sorts{0};
+            // バケットiは[2^i, 2^(i+1))マイクロ秒の実行回数
+            std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKETS> histogram{};
+
+            ~Slot();
+        };
+
+        /**
+         * @brief 空白を1つにまとめて正規化した場合のハッシュ値を、文字列を作成せずに求めます。
+         */
+        static uint64_t _hash(std::string_view sql_);
+
+        /**
+         * @brief 空白を1つにまとめ、前後の空白を取り除きます。
+         */
+        static std::string _normalize(std::string_view sql_);
+
+        /**
+         * @brief sql文のスロットを検索し、存在しなければ確保します。
+         * @return スロット。集計表が満杯の場合は_overflow
+         */
+        static Slot& _findSlot(std::string_view sql_);
+
+        static Summary _summarize(const Slot& slot_, std::string sql_);
+
+        static std::array<Slot, CAPACITY> _slots;
+        static Slot _overflow;
+        static std::atomic<bool> _enabled;
+    };
+} // core::db
+
+#endif //QUERYSTATS_H
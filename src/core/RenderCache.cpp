@@ -0,0 +1,41 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "RenderCache.h"
+
+#include "TodoAndTimeCardApp.h"
+
+namespace core {
+    void RenderCache::markDirty() { _dirty = true; }
+
+    ftxui::Element RenderCache::render(const unsigned long long revision_,
+                                       const std::function<ftxui::Element()>& build_)
+    {
+        const unsigned long long input_generation = TodoAndTimeCardApp::getInputGeneration();
+        if (_element && !_dirty && revision_ == _revision && input_generation == _input_generation) return _element;
+        _element = build_();
+        _revision = revision_;
+        _input_generation = input_generation;
+        _dirty = false;
+        return _element;
+    }
+} // core
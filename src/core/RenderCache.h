@@ -0,0 +1,68 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/**
+ * @file RenderCache.h
+ * @date 26/10/16
+ * @brief コンポーネントの描画結果を、入力が変わるまで再利用するキャッシュ
+ * @details タイマーのティックなど、一部の表示のみが変わる再描画で、重い部分木の構築を省略するために使用します。
+ * @author saku shirakura (saku@sakushira.com)
+ */
+
+
+#ifndef RENDERCACHE_H
+#define RENDERCACHE_H
+#include <functional>
+#include <ftxui/dom/elements.hpp>
+
+namespace core {
+    /**
+     * @brief 部分木の描画結果(ftxui::Element)を保持し、汚れていない間は作り直さずに返します。
+     * @details 次のいずれかの場合に汚れているとみなし、作り直します。
+     * - markDirty()が呼び出された。
+     * - render()に渡したリビジョンが前回と異なる。
+     * - 前回の描画以降にユーザーの入力があった(フォーカスや選択状態が変わる可能性があるため)。
+     * @note UIスレッドからのみ使用してください。
+     */
+    class RenderCache final {
+    public:
+        /**
+         * @brief 次の描画で作り直すようにします。
+         */
+        void markDirty();
+
+        /**
+         * @brief 保持している描画結果を返します。汚れている場合はbuild_で作り直します。
+         * @param revision_ 部分木の入力の版。入力を変更するたびに異なる値を渡してください。
+         * @param build_ 部分木を構築する関数
+         */
+        ftxui::Element render(unsigned long long revision_, const std::function<ftxui::Element()>& build_);
+
+    private:
+        ftxui::Element _element{};
+        unsigned long long _revision{0};
+        unsigned long long _input_generation{0};
+        bool _dirty{true};
+    };
+} // core
+
+#endif //RENDERCACHE_H
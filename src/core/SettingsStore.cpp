@@ -0,0 +1,204 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "SettingsStore.h"
+
+#include <algorithm>
+#include <exception>
+#include <ranges>
+#include <string>
+#include <utility>
+
+#include "DBManager.h"
+#include "../utilities/Utilities.h"
+
+namespace core {
+    namespace {
+        // ±hhmm形式のタイムゾーンを、UTCとの差の秒数に変換する。
+        long long parseTimezone(const std::string& tz_config_)
+        {
+            int raw_difference = 0;
+            try { raw_difference = std::stoi(tz_config_); }
+            catch (std::exception&) { return 0; }
+            const int abs_difference = abs(raw_difference);
+            const int difference_min = util::fitInt(abs_difference % 100, 59, 0);
+            const int difference_hour = util::fitInt(abs_difference / 100 % 100, 24, 0);
+            return (difference_hour * 3600 + difference_min * 60) * (raw_difference < 0 ? -1 : 1);
+        }
+
+        std::optional<Logger::LogLevel> parseLogLevel(const std::string& level_)
+        {
+            if (level_ == "debug") return Logger::LogLevel::DEBUG;
+            if (level_ == "info") return Logger::LogLevel::INFO;
+            if (level_ == "warning") return Logger::LogLevel::WARNING;
+            if (level_ == "error") return Logger::LogLevel::ERROR;
+            if (level_ == "critical") return Logger::LogLevel::CRITICAL;
+            return std::nullopt;
+        }
+
+        // "off"などの数値以外の値は0として扱う。
+        long long parseNumber(const std::string& value_)
+        {
+            try { return std::stoll(value_); }
+            catch (std::exception&) { return 0; }
+        }
+    }
+
+    const std::string& SettingsStore::Snapshot::value(const std::string& setting_key_) const
+    {
+        static const std::string empty{};
+        const auto found = values.find(setting_key_);
+        return found == values.end() ? empty : found->second;
+    }
+
+    std::shared_ptr<const SettingsStore::Snapshot> SettingsStore::snapshot()
+    {
+        if (auto current = _snapshot.load(std::memory_order_acquire)) return current;
+        if (reload() != 0) {
+            // 読み込めない場合も呼び出し元が既定値で動作できるよう、空のスナップショットを返す。
+            // 保存はしないため、次回の呼び出しで再度読み込みを試みる。
+            auto fallback = std::make_shared<Snapshot>();
+            _parse(*fallback);
+            return fallback;
+        }
+        return _snapshot.load(std::memory_order_acquire);
+    }
+
+    int SettingsStore::reload()
+    {
+        std::lock_guard lock(_write_mtx);
+        return _reloadLocked();
+    }
+
+    int SettingsStore::_reloadLocked()
+    {
+        db::SettingTable tbl{};
+        if (const int select_err = tbl.selectRecords(); select_err != 0) return select_err;
+        auto next = std::make_shared<Snapshot>();
+        next->values.reserve(tbl.getKeys().size());
+        for (const auto& id : tbl.getKeys()) {
+            const db::Setting& setting = tbl.getTable().at(id);
+            next->values.insert_or_assign(setting.setting_key, setting.value);
+        }
+        _parse(*next);
+        _snapshot.store(std::move(next), std::memory_order_release);
+        return 0;
+    }
+
+    void SettingsStore::invalidate() { _snapshot.store(nullptr, std::memory_order_release); }
+
+    int SettingsStore::set(const std::string& setting_key_, const std::string& value_)
+    {
+        {
+            std::lock_guard lock(_write_mtx);
+            // 変化したかを比較するため、読み込まれていない場合は先に読み込む。
+            auto latest = _snapshot.load(std::memory_order_acquire);
+            if (!latest) {
+                if (const int load_err = _reloadLocked(); load_err != 0) return load_err;
+                latest = _snapshot.load(std::memory_order_acquire);
+            }
+            if (latest->values.contains(setting_key_) && latest->value(setting_key_) == value_) return 0;
+            // 行が存在しない設定キーも、更新されずに成功とならないよう挿入する。
+            db::NoMappingTable tbl;
+            if (const int upsert_err = tbl.usePlaceholderUniSql(
+                "INSERT INTO settings (setting_key, value) VALUES (?, ?)"
+                " ON CONFLICT (setting_key) DO UPDATE SET value = excluded.value;", {
+                    {db::ColType::T_TEXT, setting_key_},
+                    {db::ColType::T_TEXT, value_}
+                }); upsert_err != 0) { return upsert_err; }
+            auto next = std::make_shared<Snapshot>(*latest);
+            next->values.insert_or_assign(setting_key_, value_);
+            _parse(*next);
+            _snapshot.store(std::move(next), std::memory_order_release);
+        }
+        // 通知先がset()やsubscribe()を呼び出す場合に備え、登録の一覧のロックを解放してから呼び出す。
+        const std::lock_guard notify_lock(_notify_mtx);
+        std::vector<std::pair<ListenerId, std::function<void()>>> listeners;
+        {
+            std::lock_guard lock(_listeners_mtx);
+            if (const auto found = _listeners.find(setting_key_); found != _listeners.end())
+                listeners = found->second;
+        }
+        for (const auto& [id, listener] : listeners) {
+            // 先に呼び出した関数の中で解除された場合は呼び出さない。
+            bool is_subscribed;
+            {
+                std::lock_guard lock(_listeners_mtx);
+                const auto found = _listeners.find(setting_key_);
+                is_subscribed = found != _listeners.end() && std::ranges::any_of(
+                    found->second, [id](const auto& entry_) { return entry_.first == id; });
+            }
+            if (is_subscribed) listener();
+        }
+        return 0;
+    }
+
+    SettingsStore::ListenerId SettingsStore::subscribe(const std::string& setting_key_,
+                                                       std::function<void()> listener_)
+    {
+        if (!listener_) return 0;
+        std::lock_guard lock(_listeners_mtx);
+        const ListenerId id = ++_next_listener_id;
+        _listeners[setting_key_].emplace_back(id, std::move(listener_));
+        return id;
+    }
+
+    void SettingsStore::unsubscribe(const ListenerId id_)
+    {
+        if (id_ == 0) return;
+        {
+            std::lock_guard lock(_listeners_mtx);
+            for (auto& listeners : _listeners | std::views::values) {
+                std::erase_if(listeners, [id_](const auto& entry_) { return entry_.first == id_; });
+            }
+        }
+        // 他のスレッドで通知中の場合は、その終了を待つ。
+        const std::lock_guard notify_lock(_notify_mtx);
+    }
+
+    void SettingsStore::_parse(Snapshot& snapshot_)
+    {
+        snapshot_.timezone_difference_seconds = parseTimezone(snapshot_.value("timezone"));
+        snapshot_.log_level = parseLogLevel(snapshot_.value("log level"));
+        // "debug"以外の値のうち、"off"は警告以上のみを出力し、それ以外は全体のログレベルに従う。
+        const std::string& query_level = snapshot_.value("query log level");
+        if (query_level == "debug") snapshot_.query_log_level = Logger::LogLevel::DEBUG;
+        else if (query_level == "off") snapshot_.query_log_level = Logger::LogLevel::WARNING;
+        else snapshot_.query_log_level = std::nullopt;
+        if (snapshot_.values.contains("query log sampling")) {
+            const long long sampling = parseNumber(snapshot_.value("query log sampling"));
+            snapshot_.query_log_sampling = sampling > 0 ? static_cast<size_t>(sampling) : 1;
+        }
+        else { snapshot_.query_log_sampling = std::nullopt; }
+        if (snapshot_.values.contains("slow query threshold"))
+            snapshot_.slow_query_threshold_ms = parseNumber(snapshot_.value("slow query threshold"));
+        else snapshot_.slow_query_threshold_ms = std::nullopt;
+    }
+
+    std::atomic<std::shared_ptr<const SettingsStore::Snapshot>> SettingsStore::_snapshot{};
+    std::mutex SettingsStore::_write_mtx{};
+    std::mutex SettingsStore::_listeners_mtx{};
+    std::recursive_mutex SettingsStore::_notify_mtx{};
+    std::unordered_map<std::string, std::vector<std::pair<SettingsStore::ListenerId, std::function<void()>>>>
+    SettingsStore::_listeners{};
+    SettingsStore::ListenerId SettingsStore::_next_listener_id{0};
+} // core
@@ -0,0 +1,150 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/**
+ * @file SettingsStore.h
+ * @date 26/10/16
+ * @brief settingsテーブルをメモリ上に保持する設定ストア
+ * @details 設定値は起動後に1度だけ読み込み、解析済みの値をスナップショットとして提供します。
+ * @author saku shirakura (saku@sakushira.com)
+ */
+
+
+#ifndef SETTINGSSTORE_H
+#define SETTINGSSTORE_H
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Logger.h"
+
+namespace core {
+    /**
+     * @brief settingsテーブルの内容と、解析済みの設定値を保持するストアです。
+     * @details 設定値は不変のスナップショット(Snapshot)として保持し、変更時は新しいスナップショットに差し替えます。
+     * 読み取り側はスナップショットを取得するのみで、ロックやデータベースの読み取りは発生しません。
+     * @details set()はsettingsテーブルへ書き込んだ後にスナップショットを差し替え、subscribe()で登録された関数を呼び出します。
+     * @note settingsテーブルへの書き込みは、このクラスを通して行ってください。直接書き込んだ場合、reload()を呼ぶまで反映されません。
+     */
+    class SettingsStore final {
+    public:
+        SettingsStore() = delete;
+
+        // 登録した関数を識別するID。0は無効なIDです。
+        using ListenerId = unsigned long long;
+
+        /**
+         * @brief ある時点の設定値です。
+         */
+        struct Snapshot {
+            // 設定キーと値の組み合わせ
+            std::unordered_map<std::string, std::string> values{};
+            // タイムゾーン(±hhmm)をUTCとの差の秒数に変換した値
+            long long timezone_difference_seconds{0};
+            // 全体のログレベル。未設定の場合はnullopt
+            std::optional<Logger::LogLevel> log_level{};
+            // クエリログ(報告者: DBManager)のログレベル。全体のログレベルに従う場合はnullopt
+            std::optional<Logger::LogLevel> query_log_level{};
+            // クエリログの間引き間隔。未設定の場合はnullopt
+            std::optional<size_t> query_log_sampling{};
+            // 低速クエリとみなす閾値(ミリ秒)。未設定の場合はnullopt
+            std::optional<long long> slow_query_threshold_ms{};
+
+            /**
+             * @brief 設定値を取得します。
+             * @return 設定キーが存在しない場合は空文字列
+             */
+            const std::string& value(const std::string& setting_key_) const;
+        };
+
+        /**
+         * @brief 現在のスナップショットを取得します。
+         * @details 読み込まれていない場合は、settingsテーブルを読み込みます。
+         * 読み込みに失敗した場合は、既定値のみのスナップショットを返します。
+         */
+        static std::shared_ptr<const Snapshot> snapshot();
+
+        /**
+         * @brief settingsテーブルを読み込み直し、スナップショットを差し替えます。
+         * @return 成功ステータス。0以外の値が返った場合、スナップショットは変更されません。
+         */
+        static int reload();
+
+        /**
+         * @brief スナップショットを破棄します。次回のsnapshot()で読み込み直されます。
+         * @details データベースファイルが切り替わる時に、DBManagerから呼ばれます。
+         */
+        static void invalidate();
+
+        /**
+         * @brief 設定値をsettingsテーブルへ書き込み、スナップショットに反映します。
+         * @details 設定キーの行が存在しない場合は挿入します。
+         * @details 値が変化した場合のみ書き込み、setting_key_に登録された関数を呼び出します。
+         * スナップショットが読み込まれていない場合は、比較のために先に読み込みます。
+         * @return 成功ステータス。0以外の値が返った場合、スナップショットは変更されず、通知もされません。
+         */
+        static int set(const std::string& setting_key_, const std::string& value_);
+
+        /**
+         * @brief setting_key_の値がset()で変更された時に呼び出す関数を登録します。
+         * @details 関数はset()を呼び出したスレッドで、新しいスナップショットへの差し替えが完了した後に呼ばれます。
+         * @details 関数が参照するオブジェクトを破棄する前に、unsubscribe()で登録を解除してください。
+         * @return 登録を識別するID。listener_が空の場合は0
+         */
+        static ListenerId subscribe(const std::string& setting_key_, std::function<void()> listener_);
+
+        /**
+         * @brief 登録を解除します。
+         * @details 他のスレッドで通知中であれば、その終了を待ってから戻ります。戻った後に関数が呼び出されることはありません。
+         * 通知中の関数から呼び出すこともできます。
+         */
+        static void unsubscribe(ListenerId id_);
+
+    private:
+        /**
+         * @brief settingsテーブルの値から解析済みの値を求めます。
+         */
+        static void _parse(Snapshot& snapshot_);
+
+        /**
+         * @brief settingsテーブルを読み込み、スナップショットを差し替えます。_write_mtxを保持して呼び出してください。
+         */
+        static int _reloadLocked();
+
+        static std::atomic<std::shared_ptr<const Snapshot>> _snapshot;
+        // 読み込みと書き込みを直列化する。スナップショットの読み取りには使用しない。
+        static std::mutex _write_mtx;
+        static std::mutex _listeners_mtx;
+        // 通知中は保持し、unsubscribe()が通知の終了を待つために使用する。通知先がset()を呼び出せるよう再帰可能とする。
+        static std::recursive_mutex _notify_mtx;
+        static std::unordered_map<std::string, std::vector<std::pair<ListenerId, std::function<void()>>>> _listeners;
+        static ListenerId _next_listener_id;
+    };
+} // core
+
+#endif //SETTINGSSTORE_H
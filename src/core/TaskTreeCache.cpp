@@ -0,0 +1,595 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TaskTreeCache.h"
+
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <tuple>
+
+namespace core::db {
+    namespace {
+        // 子タスクの並び順 (status_id, name, id)
+        template <typename T>
+        auto pageOrderKey(const T& node_) { return std::tie(node_.status_id, node_.name, node_.id); }
+    }
+
+    void TaskTreeCache::attach(sqlite3* db_)
+    {
+        clear();
+        if (db_ == nullptr) return;
+        sqlite3_update_hook(db_, &TaskTreeCache::_onUpdate, nullptr);
+        sqlite3_rollback_hook(db_, &TaskTreeCache::_onRollback, nullptr);
+    }
+
+    void TaskTreeCache::detach(sqlite3* db_)
+    {
+        if (db_ != nullptr) {
+            sqlite3_update_hook(db_, nullptr, nullptr);
+            sqlite3_rollback_hook(db_, nullptr, nullptr);
+        }
+        clear();
+    }
+
+    void TaskTreeCache::clear()
+    {
+        std::lock_guard lock(_mtx);
+        _clearLocked();
+    }
+
+    std::pair<int, Task> TaskTreeCache::fetchTask(const long long task_id_)
+    {
+        if (const int err = _resolvePending(); err != 0) return {err, Task()};
+        if (const int err = _ensureTask(task_id_); err != 0) return {err, Task()};
+        std::lock_guard lock(_mtx);
+        const auto found = _nodes.find(task_id_);
+        // 読み込んだ直後に削除された場合
+        if (found == _nodes.end()) return {-2, Task()};
+        return {0, _toTask(*found->second)};
+    }
+
+    std::optional<std::string> TaskTreeCache::findTaskDetail(const long long task_id_)
+    {
+        std::lock_guard lock(_mtx);
+        const auto found = _task_details.find(task_id_);
+        if (found == _task_details.end()) return std::nullopt;
+        return found->second;
+    }
+
+    std::pair<int, ChildTaskPage> TaskTreeCache::fetchChildTaskWindow(TaskTable& table_, const long long parent_task_id_,
+                                                                      const int status_filter_, const long long offset_,
+                                                                      const long long count_)
+    {
+        const WindowKey key = _windowKey(parent_task_id_, status_filter_);
+        if (const int err = _resolvePending(); err != 0) return {err, ChildTaskPage()};
+        for (int attempt = 0; attempt < MAX_LOAD_RETRY; attempt++) {
+            if (const int err = _ensureWindow(key.first, key.second, offset_, count_); err != 0)
+                return {err, ChildTaskPage()};
+
+            ChildTaskPage page;
+            std::vector<Task> tasks;
+            {
+                std::lock_guard lock(_mtx);
+                // 読み込んだ直後に破棄された場合は、読み込み直す。
+                const ChildWindow* window = _findWindowLocked(key);
+                if (window == nullptr || !_coversLocked(*window, offset_, count_)) continue;
+                page.parent_name = window->parent_name;
+                page.total_count = window->total_count;
+                const long long begin = std::min(std::max(0LL, offset_), page.total_count);
+                const long long end = std::min(begin + std::max(0LL, count_), page.total_count);
+                for (long long i = begin; i < end; i++) {
+                    tasks.emplace_back(_toTask(*window->rows.at(static_cast<size_t>(i - window->offset))));
+                }
+            }
+            _fillTable(table_, tasks);
+            return {0, page};
+        }
+        return {-1, ChildTaskPage()};
+    }
+
+    std::pair<int, TaskLocation> TaskTreeCache::locateTask(TaskTable& table_, const long long task_id_,
+                                                           const int status_filter_, const int per_page_)
+    {
+        if (per_page_ <= 0) return {-1, TaskLocation()};
+        if (const int err = _resolvePending(); err != 0) return {err, TaskLocation()};
+        if (const int err = _ensureTask(task_id_); err != 0) return {err, TaskLocation()};
+
+        unsigned long long generation;
+        {
+            std::lock_guard lock(_mtx);
+            const auto found = _nodes.find(task_id_);
+            if (found == _nodes.end()) return {-2, TaskLocation()};
+            const Node* target = found->second;
+            const WindowKey key = _windowKey(target->parent_id, status_filter_);
+            if (key.second != 0 && target->status_id != key.second) return {-2, TaskLocation()};
+
+            // ウィンドウを二分探索し、ページ全体がウィンドウに含まれていればメモリ上のみで求める。
+            if (const ChildWindow* window = _findWindowLocked(key)) {
+                const auto position = std::ranges::lower_bound(window->rows, pageOrderKey(*target), {},
+                                                               [](const Node* node_) { return pageOrderKey(*node_); });
+                if (position != window->rows.end() && *position == target) {
+                    const long long rank = window->offset + std::distance(window->rows.begin(), position);
+                    const long long page_begin = rank - rank % per_page_;
+                    if (_coversLocked(*window, page_begin, per_page_)) {
+                        TaskLocation location;
+                        location.parent_id = key.first;
+                        location.page_num = rank / per_page_ + 1;
+                        location.page_pos = rank % per_page_;
+                        location.page.parent_name = window->parent_name;
+                        location.page.total_count = window->total_count;
+                        const long long page_end = std::min(page_begin + per_page_, window->total_count);
+                        std::vector<Task> tasks;
+                        for (long long i = page_begin; i < page_end; i++) {
+                            tasks.emplace_back(_toTask(*window->rows.at(static_cast<size_t>(i - window->offset))));
+                        }
+                        _fillTable(table_, tasks);
+                        return {0, location};
+                    }
+                }
+            }
+            generation = _generation;
+        }
+
+        // ウィンドウの外にある場合は、順位の探索とページの取得を1つの文で行う。
+        TaskTable table;
+        TaskLocation location;
+        {
+            const DBManager::LatestReadScope latest_read_scope;
+            const auto [err, fetched] = table.locateTask(task_id_, status_filter_, per_page_);
+            if (err != 0) return {err, TaskLocation()};
+            location = fetched;
+        }
+        std::vector<Task> tasks;
+        for (const long long id : table.getKeys()) {
+            const Task& task = table.getTable().at(id);
+            tasks.emplace_back(Task(task.id, task.parent_id, task.name, "", task.status_id, task.created_at,
+                                    task.updated_at));
+        }
+        {
+            std::lock_guard lock(_mtx);
+            // 読み込み中に変更された場合、位置がずれている可能性があるため保持しない。
+            if (generation == _generation) {
+                _storeWindowLocked(_windowKey(location.parent_id, status_filter_),
+                                   (location.page_num - 1) * per_page_, table, location.page);
+            }
+        }
+        _fillTable(table_, tasks);
+        return {0, location};
+    }
+
+    int TaskTreeCache::prefetchChildWindow(const long long parent_task_id_, const int status_filter_,
+                                           const long long offset_, const long long count_)
+    {
+        if (const int err = _resolvePending(); err != 0) return err;
+        const WindowKey key = _windowKey(parent_task_id_, status_filter_);
+        return _ensureWindow(key.first, key.second, offset_, count_);
+    }
+
+    bool TaskTreeCache::isWindowCovered(const long long parent_task_id_, const int status_filter_,
+                                        const long long offset_, const long long count_)
+    {
+        const WindowKey key = _windowKey(parent_task_id_, status_filter_);
+        std::lock_guard lock(_mtx);
+        if (!_pending.empty()) return false;
+        const ChildWindow* window = _findWindowLocked(key);
+        return window != nullptr && _coversLocked(*window, offset_, count_);
+    }
+
+    bool TaskTreeCache::isSelfOrDescendant(const long long ancestor_id_, const long long task_id_)
+    {
+        if (ancestor_id_ <= 0 || task_id_ <= 0) return false;
+        if (_resolvePending() != 0) return false;
+        long long current_id = task_id_;
+        while (current_id > 0) {
+            if (current_id == ancestor_id_) return true;
+            if (_ensureTask(current_id) != 0) return false;
+            std::lock_guard lock(_mtx);
+            const auto found = _nodes.find(current_id);
+            if (found == _nodes.end()) return false;
+            // 読み込み済みの祖先は、ロックを保持したまま親へのポインタを辿る。
+            Node* node = found->second;
+            while (Node* parent = _parentLocked(node)) {
+                if (parent->is_stale) break;
+                node = parent;
+                if (node->id == ancestor_id_) return true;
+            }
+            current_id = node->parent_id;
+        }
+        return false;
+    }
+
+    std::optional<TaskDetailSnapshot> TaskTreeCache::findDetailSnapshot(const long long task_id_,
+                                                                      const long long active_task_id_)
+    {
+        std::lock_guard lock(_mtx);
+        const auto found = _details.find(task_id_);
+        if (found == _details.end() || found->second.first != active_task_id_) return std::nullopt;
+        return found->second.second;
+    }
+
+    std::pair<int, TaskDetailSnapshot> TaskTreeCache::fetchDetailSnapshot(const long long task_id_,
+                                                                          const long long active_task_id_)
+    {
+        for (int attempt = 0; attempt < MAX_LOAD_RETRY; attempt++) {
+            unsigned long long generation;
+            {
+                std::lock_guard lock(_mtx);
+                if (const auto found = _details.find(task_id_);
+                    found != _details.end() && found->second.first == active_task_id_) {
+                    return {0, found->second.second};
+                }
+                generation = _detail_generation;
+            }
+            const DBManager::LatestReadScope latest_read_scope;
+            auto [err, snapshot] = TaskTable::fetchDetailSnapshot(task_id_, active_task_id_);
+            if (err != 0) return {err, snapshot};
+
+            std::lock_guard lock(_mtx);
+            // 読み込み中に変更された場合、読み込んだ値が最新とは限らないため保持しない。
+            if (generation != _detail_generation) continue;
+            if (_details.size() >= MAX_DETAIL_SNAPSHOTS) _details.clear();
+            _details.erase(task_id_);
+            _details.try_emplace(task_id_, active_task_id_, snapshot);
+            if (snapshot.task) {
+                if (_task_details.size() >= MAX_TASK_DETAILS) _task_details.clear();
+                _task_details.insert_or_assign(task_id_, snapshot.task->detail);
+            }
+            return {0, snapshot};
+        }
+        return {-1, TaskDetailSnapshot()};
+    }
+
+    void TaskTreeCache::_onUpdate(void*, const int operation_, const char* db_name_, const char* table_name_,
+                                  const sqlite3_int64 row_id_)
+    {
+        if (std::strcmp(db_name_, "main") != 0) return;
+        std::lock_guard lock(_mtx);
+        // 作業時間の変更は祖先の合計にも影響するため、タスクの詳細は全て破棄する。
+        if (_isDetailSourceTable(table_name_)) {
+            _details.clear();
+            _detail_generation++;
+        }
+        if (std::strcmp(table_name_, "task") != 0) return;
+        _generation++;
+        const auto found = _nodes.find(row_id_);
+        switch (operation_) {
+        case SQLITE_DELETE:
+            if (found != _nodes.end()) {
+                _invalidateChildrenLocked(found->second->parent_id);
+                _releaseLocked(found->second);
+            }
+            // 読み込んでいないタスクは親が分からないため、ウィンドウの位置と総数が変わり得るものとして全て破棄する。
+            else { _windows.clear(); }
+            _task_details.erase(row_id_);
+            _pending.erase(row_id_);
+            break;
+        case SQLITE_UPDATE:
+            // 並び順や親が変わる可能性があるため、現在の親のウィンドウを破棄し、移動先は読み込み直す時に破棄する。
+            if (found != _nodes.end()) {
+                _invalidateChildrenLocked(found->second->parent_id);
+                found->second->is_stale = true;
+            }
+            else { _windows.clear(); }
+            _task_details.erase(row_id_);
+            _pending.insert(row_id_);
+            break;
+        case SQLITE_INSERT:
+            _pending.insert(row_id_);
+            break;
+        default:
+            break;
+        }
+    }
+
+    bool TaskTreeCache::_isDetailSourceTable(const char* table_name_)
+    {
+        return std::strcmp(table_name_, "task") == 0 || std::strcmp(table_name_, "worktime") == 0 ||
+            std::strcmp(table_name_, "task_worktime_total") == 0 || std::strcmp(table_name_, "task_closure") == 0;
+    }
+
+    void TaskTreeCache::_onRollback(void*)
+    {
+        // 取り消された変更を特定できないため、全て破棄する。
+        std::lock_guard lock(_mtx);
+        _generation++;
+        _clearLocked();
+    }
+
+    int TaskTreeCache::_resolvePending()
+    {
+        std::vector<long long> pending;
+        unsigned long long generation;
+        {
+            std::lock_guard lock(_mtx);
+            if (_pending.empty()) return 0;
+            if (_pending.size() > MAX_PENDING_TASKS) {
+                _clearLocked();
+                return 0;
+            }
+            pending.assign(_pending.begin(), _pending.end());
+            generation = _generation;
+        }
+
+        std::string placeholders;
+        std::vector<ColValue> placeholder_values;
+        for (const long long id : pending) {
+            placeholders += placeholders.empty() ? "?" : ", ?";
+            placeholder_values.emplace_back(ColType::T_INTEGER, id);
+        }
+        TaskTable table;
+        {
+            const DBManager::LatestReadScope latest_read_scope;
+            if (const int err = table.selectRecords(std::format("id IN ({})", placeholders), placeholder_values);
+                err != 0) { return err; }
+        }
+
+        std::lock_guard lock(_mtx);
+        for (const long long id : pending) {
+            // 移動先の親のウィンドウを破棄する。ノードは、読み込み中に変更されていない場合のみ更新する。
+            const auto found = table.getTable().find(id);
+            if (found == table.getTable().end()) continue;
+            _invalidateChildrenLocked(found->second.parent_id <= 0 ? 0 : found->second.parent_id);
+            if (generation == _generation) _storeLocked(found->second);
+        }
+        if (generation == _generation) _pending.clear();
+        return 0;
+    }
+
+    int TaskTreeCache::_ensureTask(const long long task_id_)
+    {
+        for (int attempt = 0; attempt < MAX_LOAD_RETRY; attempt++) {
+            unsigned long long generation;
+            {
+                std::lock_guard lock(_mtx);
+                if (const auto found = _nodes.find(task_id_); found != _nodes.end() && !found->second->is_stale)
+                    return 0;
+                generation = _generation;
+            }
+            TaskTable table;
+            {
+                const DBManager::LatestReadScope latest_read_scope;
+                if (const int err = table.selectRecords("id=?", {{ColType::T_INTEGER, task_id_}}); err != 0)
+                    return err;
+            }
+            const auto found = table.getTable().find(task_id_);
+            if (found == table.getTable().end()) return -2;
+            std::lock_guard lock(_mtx);
+            if (generation != _generation) continue;
+            _storeLocked(found->second);
+            return 0;
+        }
+        return -1;
+    }
+
+    int TaskTreeCache::_ensureWindow(const long long parent_id_, const int status_filter_, const long long offset_,
+                                     const long long count_)
+    {
+        const WindowKey key{parent_id_, status_filter_};
+        const long long begin = std::max(0LL, offset_);
+        for (int attempt = 0; attempt < MAX_LOAD_RETRY; attempt++) {
+            unsigned long long generation;
+            // 既定では、離れた範囲としてOFFSETで読み込む。
+            TaskPageSeek seek = TaskPageSeek::OFFSET;
+            TaskPageKey seek_key{};
+            long long fetch_offset = begin;
+            long long fetch_count = std::max(0LL, count_);
+            {
+                std::lock_guard lock(_mtx);
+                if (const ChildWindow* window = _findWindowLocked(key)) {
+                    if (_coversLocked(*window, offset_, count_)) return 0;
+                    const long long end = std::min(begin + fetch_count, window->total_count);
+                    const long long window_end = window->offset + static_cast<long long>(window->rows.size());
+                    // ウィンドウに続く範囲は、端のタスクをキーとして不足する行のみを読み込む。
+                    if (!window->rows.empty() && begin >= window->offset && begin <= window_end) {
+                        seek = TaskPageSeek::AFTER;
+                        seek_key = TaskPageKey{window->rows.back()->status_id, window->rows.back()->name,
+                                               window->rows.back()->id};
+                        fetch_offset = window_end;
+                        fetch_count = end - window_end;
+                    }
+                    else if (!window->rows.empty() && end >= window->offset && end <= window_end) {
+                        seek = TaskPageSeek::BEFORE;
+                        seek_key = TaskPageKey{window->rows.front()->status_id, window->rows.front()->name,
+                                               window->rows.front()->id};
+                        fetch_offset = begin;
+                        fetch_count = window->offset - begin;
+                    }
+                }
+                generation = _generation;
+            }
+
+            TaskTable table;
+            ChildTaskPage page;
+            {
+                const DBManager::LatestReadScope latest_read_scope;
+                const auto [err, fetched] = table.fetchChildTaskPage(parent_id_, status_filter_,
+                                                                     static_cast<int>(fetch_count), seek, seek_key,
+                                                                     fetch_offset);
+                if (err != 0) return err;
+                page = fetched;
+            }
+
+            std::lock_guard lock(_mtx);
+            // 読み込み中に変更された場合、位置がずれている可能性があるため保持しない。
+            if (generation != _generation) continue;
+            _storeWindowLocked(key, fetch_offset, table, page);
+            return 0;
+        }
+        return -1;
+    }
+
+    bool TaskTreeCache::_coversLocked(const ChildWindow& window_, const long long offset_, const long long count_)
+    {
+        const long long begin = std::max(0LL, offset_);
+        const long long end = std::min(begin + std::max(0LL, count_), window_.total_count);
+        // 総数を超える範囲には行がないため、含んでいるものとする。
+        if (begin >= end) return true;
+        return begin >= window_.offset && end <= window_.offset + static_cast<long long>(window_.rows.size());
+    }
+
+    void TaskTreeCache::_storeWindowLocked(const WindowKey& key_, const long long offset_, const TaskTable& table_,
+                                           const ChildTaskPage& page_)
+    {
+        const auto& keys = table_.getKeys();
+        if (_nodes.size() + keys.size() > MAX_NODES) _clearLocked();
+        if (!_windows.contains(key_) && _windows.size() >= MAX_WINDOWS) _windows.clear();
+
+        std::vector<Node*> rows;
+        rows.reserve(keys.size());
+        for (const long long id : keys) rows.emplace_back(_storeLocked(table_.getTable().at(id)));
+
+        ChildWindow& window = _windows[key_];
+        const long long new_end = offset_ + static_cast<long long>(rows.size());
+        const long long window_end = window.offset + static_cast<long long>(window.rows.size());
+        // 総数が変わらず、既存の範囲と隣接または重なる場合のみ連結する。そうでなければ置き換える。
+        if (!window.rows.empty() && window.total_count == page_.total_count && offset_ <= window_end &&
+            new_end >= window.offset) {
+            const long long merged_begin = std::min(window.offset, offset_);
+            const long long merged_end = std::max(window_end, new_end);
+            std::vector<Node*> merged(static_cast<size_t>(merged_end - merged_begin), nullptr);
+            std::ranges::copy(window.rows, merged.begin() + (window.offset - merged_begin));
+            std::ranges::copy(rows, merged.begin() + (offset_ - merged_begin));
+            // 読み込んだ範囲から遠い側を切り捨てる。
+            long long kept_begin = merged_begin;
+            if (merged.size() > MAX_WINDOW_ROWS) {
+                const auto excess = static_cast<long long>(merged.size() - MAX_WINDOW_ROWS);
+                if (new_end == merged_end) {
+                    merged.erase(merged.begin(), merged.begin() + excess);
+                    kept_begin += excess;
+                }
+                else { merged.erase(merged.end() - excess, merged.end()); }
+            }
+            window.offset = kept_begin;
+            window.rows = std::move(merged);
+        }
+        else {
+            window.offset = offset_;
+            window.rows = std::move(rows);
+        }
+        window.total_count = page_.total_count;
+        window.parent_name = page_.parent_name;
+    }
+
+    TaskTreeCache::ChildWindow* TaskTreeCache::_findWindowLocked(const WindowKey& key_)
+    {
+        const auto found = _windows.find(key_);
+        return found == _windows.end() ? nullptr : &found->second;
+    }
+
+    TaskTreeCache::WindowKey TaskTreeCache::_windowKey(const long long parent_id_, const int status_filter_)
+    {
+        return {parent_id_ <= 0 ? 0 : parent_id_, status_filter_ > 0 && status_filter_ <= 4 ? status_filter_ : 0};
+    }
+
+    TaskTreeCache::Node* TaskTreeCache::_parentLocked(Node* node_)
+    {
+        if (node_->parent_id <= 0) return nullptr;
+        // 解放されたノードはidが0になるため、idが一致しない場合は引き直す。(idは再利用されない。)
+        if (node_->parent == nullptr || node_->parent->id != node_->parent_id) {
+            const auto found = _nodes.find(node_->parent_id);
+            node_->parent = found == _nodes.end() ? nullptr : found->second;
+        }
+        return node_->parent;
+    }
+
+    TaskTreeCache::Node* TaskTreeCache::_storeLocked(const Task& task_)
+    {
+        Node* node;
+        if (const auto found = _nodes.find(task_.id); found != _nodes.end()) { node = found->second; }
+        else {
+            if (_free_nodes.empty()) { node = &_arena.emplace_back(); }
+            else {
+                node = _free_nodes.back();
+                _free_nodes.pop_back();
+            }
+            _nodes.emplace(task_.id, node);
+        }
+        node->id = task_.id;
+        node->parent_id = task_.parent_id <= 0 ? 0 : task_.parent_id;
+        node->name = task_.name;
+        node->status_id = task_.status_id;
+        node->created_at = task_.created_at;
+        node->updated_at = task_.updated_at;
+        node->is_stale = false;
+        node->parent = nullptr;
+        _parentLocked(node);
+        return node;
+    }
+
+    void TaskTreeCache::_invalidateChildrenLocked(const long long parent_id_)
+    {
+        // ステータスフィルタごとのウィンドウは、キーの順で連続している。
+        const long long parent_id = parent_id_ <= 0 ? 0 : parent_id_;
+        _windows.erase(_windows.lower_bound({parent_id, 0}), _windows.upper_bound({parent_id, 4}));
+    }
+
+    void TaskTreeCache::_releaseLocked(Node* node_)
+    {
+        // 子のノードが持つ親へのポインタは、_parentLocked()でidを照合して引き直される。
+        _nodes.erase(node_->id);
+        *node_ = Node();
+        _free_nodes.emplace_back(node_);
+    }
+
+    void TaskTreeCache::_clearLocked()
+    {
+        _windows.clear();
+        _nodes.clear();
+        _free_nodes.clear();
+        _arena.clear();
+        _pending.clear();
+        _task_details.clear();
+        _details.clear();
+        _detail_generation++;
+    }
+
+    void TaskTreeCache::_fillTable(TaskTable& table_, const std::vector<Task>& tasks_)
+    {
+        table_._keys.clear();
+        table_._table.clear();
+        table_._keys.reserve(tasks_.size());
+        table_._table.reserve(tasks_.size());
+        for (const Task& task : tasks_) {
+            table_._keys.emplace_back(task.id);
+            table_._table.try_emplace(task.id, task);
+        }
+    }
+
+    Task TaskTreeCache::_toTask(const Node& node_)
+    {
+        return Task(node_.id, node_.parent_id, node_.name, "", node_.status_id, node_.created_at,
+                    node_.updated_at);
+    }
+
+    std::mutex TaskTreeCache::_mtx{};
+    std::deque<TaskTreeCache::Node> TaskTreeCache::_arena{};
+    std::vector<TaskTreeCache::Node*> TaskTreeCache::_free_nodes{};
+    std::unordered_map<long long, TaskTreeCache::Node*> TaskTreeCache::_nodes{};
+    std::map<TaskTreeCache::WindowKey, TaskTreeCache::ChildWindow> TaskTreeCache::_windows{};
+    std::unordered_set<long long> TaskTreeCache::_pending{};
+    unsigned long long TaskTreeCache::_generation{0};
+    std::unordered_map<long long, std::string> TaskTreeCache::_task_details{};
+    std::unordered_map<long long, std::pair<long long, TaskDetailSnapshot>> TaskTreeCache::_details{};
+    unsigned long long TaskTreeCache::_detail_generation{0};
+} // core::db
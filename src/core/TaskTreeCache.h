@@ -0,0 +1,305 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+/**
+ * @file TaskTreeCache.h
+ * @date 26/10/16
+ * @brief プロセス全体で共有するタスクツリーのキャッシュ
+ * @details 一覧の移動やタスクの選択のたびにデータベースを読み取らないよう、タスクを親子関係ごとにメモリ上に保持します。
+ * @author saku shirakura (saku@sakushira.com)
+ */
+
+
+#ifndef TASKTREECACHE_H
+#define TASKTREECACHE_H
+#include <deque>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <sqlite3.h>
+
+#include "DBManager.h"
+
+namespace core::db {
+    /**
+     * @brief タスクを親子関係ごとに保持するキャッシュです。
+     * @details ノードはアリーナ(_arena)に確保し、親へのポインタを持ちます。
+     * 子タスクは親とステータスフィルタの組ごとに、(status_id, name, id)の順で連続した範囲(ウィンドウ)のみを保持します。
+     * ウィンドウの外を参照した場合は、TaskTable::fetchChildTaskPage()とTaskTable::locateTask()で必要な行のみを読み込みます。
+     * ウィンドウに続く範囲はキーセットで読み込んで連結するため、スクロールで読み飛ばす行を数え直すことはありません。
+     * @details ノードはタスクの詳細(detail)を保持しません。詳細は、fetchDetailSnapshot()で読み込んだタスクのものだけを保持します。
+     * @details 書き込み用の接続にsqlite3_update_hookを設定し、変更されたタスクの親のウィンドウのみを破棄します。
+     * ロールバックされた場合は、全てを破棄します。
+     * @details 詳細画面に表示するタスクの詳細(TaskDetailSnapshot)も、作業時間に関わるテーブルが変更されるまで保持します。
+     * @note 他のプロセスによる変更は検出できません。
+     * @note ミューテックスを保持したままデータベースを読み取ることはありません。
+     * フックは書き込み中のDBManagerのロックを保持した状態で呼ばれるため、逆の順序でロックしないためです。
+     */
+    class TaskTreeCache final {
+    public:
+        TaskTreeCache() = delete;
+
+        /**
+         * @brief 接続にフックを設定し、キャッシュを空にします。DBManagerが書き込み用の接続を開いた時に呼ばれます。
+         */
+        static void attach(sqlite3* db_);
+
+        /**
+         * @brief 接続からフックを解除し、キャッシュを空にします。DBManagerが書き込み用の接続を閉じる前に呼ばれます。
+         */
+        static void detach(sqlite3* db_);
+
+        /**
+         * @brief キャッシュを全て破棄します。
+         */
+        static void clear();
+
+        /**
+         * @brief タスクを取得します。
+         * @note detailは含みません。必要な場合はfindTaskDetail()を使用してください。
+         * @return <成功ステータス, タスク> タスクが存在しない場合は-2を返します。
+         */
+        static std::pair<int, Task> fetchTask(long long task_id_);
+
+        /**
+         * @brief 読み込み済みのタスクの詳細(detail)を、データベースを読み取らずに取得します。
+         * @details 詳細は、fetchDetailSnapshot()で読み込んだタスクのものだけを、そのタスクが次に変更されるまで保持します。
+         * @return 読み込まれていない場合はstd::nullopt
+         */
+        static std::optional<std::string> findTaskDetail(long long task_id_);
+
+        /**
+         * @brief 子タスクのうち、offset_番目からcount_件をtable_に格納し、親タスク名と子タスクの総数を返します。
+         * @details 仮想化されたリストが、表示範囲の周辺の行のみを保持するために使用します。
+         * ウィンドウが範囲を含んでいれば、データベースを読み取らずに切り出します。
+         * @param table_ 行を格納するテーブル。getKeys()で(status_id, name, id)の昇順に並びます。detailは含みません。
+         * @param parent_task_id_ 対象の親タスクID。0以下の値が指定された場合、NULLとして扱います。
+         * @param status_filter_ 対象のステータスID。列挙型Statusに存在しない値が指定された場合は絞り込まれません。
+         * @param offset_ 0から始まる先頭の位置
+         * @param count_ 取得する最大の件数
+         * @return <成功ステータス, 親タスク名と子タスクの総数> 親タスクが存在しない場合は、空の範囲を返します。
+         */
+        static std::pair<int, ChildTaskPage> fetchChildTaskWindow(TaskTable& table_, long long parent_task_id_,
+                                                                  int status_filter_, long long offset_,
+                                                                  long long count_);
+
+        /**
+         * @brief タスクが属するページをtable_に格納し、ページ番号とページ内での位置を返します。
+         * @details ウィンドウが対象のページを含んでいれば、ウィンドウを二分探索して順位を求めます。
+         * 含んでいなければ、TaskTable::locateTask()でページのみを読み込み、ウィンドウとして保持します。
+         * @return <成功ステータス, 位置> タスクが存在しない場合や、フィルタに一致しない場合は-2を返します。
+         */
+        static std::pair<int, TaskLocation> locateTask(TaskTable& table_, long long task_id_, int status_filter_,
+                                                       int per_page_);
+
+        /**
+         * @brief 子タスクのうち、offset_番目からcount_件を、参照される前にウィンドウへ読み込んでおきます。
+         * @details ワーカースレッドから呼び出すことで、UIスレッドでのスクロールや子タスクへの移動で読み取りが発生しなくなります。
+         * @details 読み取りは書き込み用の接続で行うため、その間はUIスレッドでのキャッシュに無い範囲の読み取りを待たせます。
+         * sqlite3_update_hookはコミットより前に呼ばれるため、読み取り用の接続ではコミット前のスナップショットを
+         * 変更後の世代として保持してしまう可能性があります。呼び出す前にisWindowCovered()で確認し、不要な読み取りを避けてください。
+         * @param parent_task_id_ 対象の親タスクID。0以下の値が指定された場合、NULLとして扱います。
+         * @param status_filter_ 対象のステータスID。列挙型Statusに存在しない値が指定された場合は絞り込まれません。
+         * @param offset_ 0から始まる先頭の位置
+         * @param count_ 読み込む最大の件数
+         * @return 成功ステータス
+         */
+        static int prefetchChildWindow(long long parent_task_id_, int status_filter_, long long offset_,
+                                       long long count_);
+
+        /**
+         * @brief 子タスクのうち、offset_番目からcount_件がウィンドウに読み込み済みか、データベースを読み取らずに判定します。
+         * @details 追加されたタスクを反映していない場合は、ウィンドウの位置がずれている可能性があるためfalseを返します。
+         * @param parent_task_id_ 対象の親タスクID。0以下の値が指定された場合、NULLとして扱います。
+         * @param status_filter_ 対象のステータスID。列挙型Statusに存在しない値が指定された場合は絞り込まれません。
+         * @param offset_ 0から始まる先頭の位置
+         * @param count_ 件数
+         */
+        static bool isWindowCovered(long long parent_task_id_, int status_filter_, long long offset_, long long count_);
+
+        /**
+         * @brief task_id_が、ancestor_id_のタスク自身またはその子孫か判定します。
+         * @details 親へのポインタを辿るため、読み込み済みの祖先についてはデータベースを読み取りません。
+         */
+        static bool isSelfOrDescendant(long long ancestor_id_, long long task_id_);
+
+        /**
+         * @brief 読み込み済みのタスクの詳細を、データベースを読み取らずに取得します。
+         * @details UIスレッドから呼び出し、読み込みを待たずに表示するために使用します。
+         * @return 読み込まれていない場合や、active_task_id_が読み込んだ時と異なる場合はstd::nullopt
+         */
+        static std::optional<TaskDetailSnapshot> findDetailSnapshot(long long task_id_, long long active_task_id_);
+
+        /**
+         * @brief タスクの詳細を取得します。読み込まれていない場合は、TaskTable::fetchDetailSnapshot()で読み込みます。
+         * @details 読み込んだ詳細は、task・worktimeなどの作業時間に関わるテーブルが次に変更されるまで保持します。
+         * タスクのdetailは、findTaskDetail()で参照できるように別に保持します。
+         * @return <成功ステータス, スナップショット> タスクが存在しない場合は-2を返します。
+         */
+        static std::pair<int, TaskDetailSnapshot> fetchDetailSnapshot(long long task_id_, long long active_task_id_);
+
+    private:
+        struct Node {
+            long long id{0};
+            long long parent_id{0};
+            std::string name{};
+            long long status_id{0};
+            long long created_at{0};
+            long long updated_at{0};
+            // 親タスクのノード。_parentLocked()を通して参照します。
+            Node* parent{nullptr};
+            // 更新されたが、まだ読み込み直していない場合はtrue
+            bool is_stale{false};
+        };
+
+        /**
+         * @brief 親タスクの子タスクのうち、連続して読み込んだ範囲です。
+         */
+        struct ChildWindow {
+            // rowsの先頭の、絞り込んだ子タスクの中での位置
+            long long offset{0};
+            // (status_id, name, id)の昇順に並べた子タスクのノード
+            std::vector<Node*> rows{};
+            long long total_count{0};
+            std::string parent_name{};
+        };
+
+        // <親タスクID, ステータスフィルタ> 親タスクがない場合は0
+        using WindowKey = std::pair<long long, int>;
+
+        static void _onUpdate(void* context_, int operation_, const char* db_name_, const char* table_name_,
+                              sqlite3_int64 row_id_);
+
+        static void _onRollback(void* context_);
+
+        /**
+         * @brief タスクの詳細に含まれる値が、table_name_の変更で変わり得るか判定します。
+         */
+        static bool _isDetailSourceTable(const char* table_name_);
+
+        /**
+         * @brief フックで記録したタスクを読み込み直し、移動先の親のウィンドウを破棄します。
+         */
+        static int _resolvePending();
+
+        /**
+         * @brief タスクのノードが最新の状態で存在するようにします。
+         * @return タスクが存在しない場合は-2
+         */
+        static int _ensureTask(long long task_id_);
+
+        /**
+         * @brief ウィンドウがoffset_番目からcount_件を含む状態にします。
+         * @details ウィンドウに続く範囲はキーセット(TaskPageSeek::AFTER, BEFORE)で、離れた範囲はOFFSETで読み込みます。
+         * ReadScopeの内部から呼ばれた場合も、スナップショットではなく最新の状態を読み込みます。
+         */
+        static int _ensureWindow(long long parent_id_, int status_filter_, long long offset_, long long count_);
+
+        /**
+         * @brief ウィンドウがoffset_番目からcount_件を含んでいるか判定します。_mtxを保持して呼び出してください。
+         */
+        static bool _coversLocked(const ChildWindow& window_, long long offset_, long long count_);
+
+        /**
+         * @brief 読み込んだ行をウィンドウに反映します。既存のウィンドウと隣接または重なる場合は連結します。
+         * @details _mtxを保持して呼び出してください。
+         * @param offset_ table_の先頭の行の位置
+         */
+        static void _storeWindowLocked(const WindowKey& key_, long long offset_, const TaskTable& table_,
+                                       const ChildTaskPage& page_);
+
+        /**
+         * @brief ウィンドウを返します。_mtxを保持して呼び出してください。
+         * @return 読み込まれていない場合はnullptr
+         */
+        static ChildWindow* _findWindowLocked(const WindowKey& key_);
+
+        /**
+         * @brief 親タスクIDとステータスフィルタを、ウィンドウのキーに正規化します。
+         */
+        static WindowKey _windowKey(long long parent_id_, int status_filter_);
+
+        /**
+         * @brief 親タスクのノードを返します。ポインタが古い場合は引き直します。_mtxを保持して呼び出してください。
+         * @return 親タスクがない場合や、読み込まれていない場合はnullptr
+         */
+        static Node* _parentLocked(Node* node_);
+
+        /**
+         * @brief 読み込んだタスクをノードに反映します。_mtxを保持して呼び出してください。
+         */
+        static Node* _storeLocked(const Task& task_);
+
+        /**
+         * @brief 親タスクの全てのステータスフィルタのウィンドウを破棄します。_mtxを保持して呼び出してください。
+         */
+        static void _invalidateChildrenLocked(long long parent_id_);
+
+        static void _releaseLocked(Node* node_);
+
+        static void _clearLocked();
+
+        /**
+         * @brief tasks_を、並び順を保ったままtable_に格納します。
+         */
+        static void _fillTable(TaskTable& table_, const std::vector<Task>& tasks_);
+
+        static Task _toTask(const Node& node_);
+
+        // 読み込み中に変更された場合、再試行する回数
+        static constexpr int MAX_LOAD_RETRY = 3;
+        // 読み込み直すタスクがこの数を超える場合、個別に読み込まず全てを破棄する。
+        static constexpr size_t MAX_PENDING_TASKS = 500;
+        // 保持するタスクの詳細がこの数を超える場合、全てを破棄する。
+        static constexpr size_t MAX_DETAIL_SNAPSHOTS = 1024;
+        static constexpr size_t MAX_TASK_DETAILS = 256;
+        // 1つのウィンドウが保持する最大の行数。超える場合は、読み込んだ範囲から遠い側を切り捨てる。
+        static constexpr size_t MAX_WINDOW_ROWS = 2000;
+        // 保持するウィンドウ・ノードがこの数を超える場合、全てを破棄する。
+        static constexpr size_t MAX_WINDOWS = 64;
+        static constexpr size_t MAX_NODES = 20000;
+
+        static std::mutex _mtx;
+        static std::deque<Node> _arena;
+        static std::vector<Node*> _free_nodes;
+        static std::unordered_map<long long, Node*> _nodes;
+        static std::map<WindowKey, ChildWindow> _windows;
+        // フックで挿入・更新を検出し、まだ読み込み直していないタスクID
+        static std::unordered_set<long long> _pending;
+        // taskテーブルの変更ごとに増加する。読み込み中に変更されたか判定するために使用します。
+        static unsigned long long _generation;
+        // タスクIDと、そのタスクのdetail
+        static std::unordered_map<long long, std::string> _task_details;
+        // タスクIDと、<読み込んだ時のアクティブタスクID, タスクの詳細>
+        static std::unordered_map<long long, std::pair<long long, TaskDetailSnapshot>> _details;
+        // 作業時間に関わるテーブルの変更ごとに増加する。
+        static unsigned long long _detail_generation;
+    };
+} // core::db
+
+#endif //TASKTREECACHE_H
@@ -22,17 +22,53 @@
 
 #include "TodoAndTimeCardApp.h"
 
+#include "AsyncDB.h"
 #include "../page/PageManager.h"
+#include "../utilities/TickScheduler.h"
 
 namespace core {
     void TodoAndTimeCardApp::execute()
     {
         std::lock_guard lock(_screen_mutex);
         const pages::PageManager page{};
-        _screen.Loop(page.getComponent() | ftxui::Modal(_error_dialog, &_show_error_dialog));
+        // ユーザーの入力を数え、描画結果を再利用しているコンポーネントが作り直せるようにする。
+        const auto root = ftxui::CatchEvent(
+            page.getComponent() | ftxui::Modal(_error_dialog, &_show_error_dialog), [](const ftxui::Event& event_) {
+                if (event_ != ftxui::Event::Custom) _input_generation++;
+                return false;
+            });
+        _startFrameScheduler();
+        _screen.Loop(root);
+        _stopFrameScheduler();
+        // 画面の終了後に実行中のデータベース操作を待ち、その結果を待つ処理も実行してから、ワーカースレッドを終了する。
+        _drainAfterLoop();
+        TickScheduler::stop();
     }
 
-    void TodoAndTimeCardApp::updateScreen() { _screen.PostEvent(ftxui::Event::Custom); }
+    void TodoAndTimeCardApp::updateScreen()
+    {
+        {
+            std::lock_guard lock(_frame_mtx);
+            // 描画待ちの要求がある場合は、その描画にまとめる。
+            if (_redraw_requested) return;
+            _redraw_requested = true;
+        }
+        _frame_condition.notify_one();
+    }
+
+    void TodoAndTimeCardApp::post(std::function<void()> fn_)
+    {
+        {
+            std::lock_guard lock(_post_mtx);
+            _posted_jobs.emplace_back(std::move(fn_));
+            // 画面の終了後は、_drainAfterLoop()が実行する。
+            if (_loop_ended) return;
+        }
+        // 画面の終了時に実行されなかった処理を_drainAfterLoop()で実行できるように、処理自体は_posted_jobsで保持する。
+        _screen.Post([] { _runPostedJobs(); });
+        // Post()のみでは再描画されないため、再描画も要求する。
+        updateScreen();
+    }
 
     void TodoAndTimeCardApp::setError(const std::string& msg) { _error_dialog->setError(msg); }
 
@@ -40,10 +76,85 @@ namespace core {
 
     void TodoAndTimeCardApp::close() { _show_error_dialog = false; }
 
+    unsigned long long TodoAndTimeCardApp::getInputGeneration() { return _input_generation; }
+
+    void TodoAndTimeCardApp::_runPostedJobs()
+    {
+        std::deque<std::function<void()>> jobs;
+        {
+            std::lock_guard lock(_post_mtx);
+            jobs.swap(_posted_jobs);
+        }
+        for (auto& job : jobs) job();
+    }
+
+    void TodoAndTimeCardApp::_drainAfterLoop()
+    {
+        {
+            std::lock_guard lock(_post_mtx);
+            _loop_ended = true;
+        }
+        while (true) {
+            // 待機中の処理を含めて全て実行し、ワーカースレッドを終了する。完了した処理の続きは_posted_jobsに入る。
+            db::DBWorker::stop();
+            {
+                std::lock_guard lock(_post_mtx);
+                if (_posted_jobs.empty()) return;
+            }
+            // 続きの処理が再びデータベース操作を行った場合は、ワーカースレッドが再開するため、もう一度終了を待つ。
+            _runPostedJobs();
+        }
+    }
+
+    void TodoAndTimeCardApp::_frameThreadProcess()
+    {
+        std::unique_lock lock(_frame_mtx);
+        std::chrono::steady_clock::time_point last_frame{};
+        while (true) {
+            _frame_condition.wait(lock, [] { return _redraw_requested || !_frame_loop; });
+            // 前回の描画から1フレーム分待機する。待機中の要求は、この描画にまとめられる。
+            _frame_condition.wait_until(lock, last_frame + FRAME_INTERVAL, [] { return !_frame_loop; });
+            if (!_frame_loop) return;
+            _redraw_requested = false;
+            last_frame = std::chrono::steady_clock::now();
+            lock.unlock();
+            _screen.PostEvent(ftxui::Event::Custom);
+            lock.lock();
+        }
+    }
+
+    void TodoAndTimeCardApp::_startFrameScheduler()
+    {
+        {
+            std::lock_guard lock(_frame_mtx);
+            _frame_loop = true;
+        }
+        _frame_thread = std::thread(&TodoAndTimeCardApp::_frameThreadProcess);
+    }
+
+    void TodoAndTimeCardApp::_stopFrameScheduler()
+    {
+        {
+            std::lock_guard lock(_frame_mtx);
+            _frame_loop = false;
+        }
+        _frame_condition.notify_all();
+        if (_frame_thread.joinable()) _frame_thread.join();
+    }
+
     ftxui::ScreenInteractive TodoAndTimeCardApp::_screen{ftxui::ScreenInteractive::TerminalOutput()};
     std::mutex TodoAndTimeCardApp::_screen_mutex;
     std::shared_ptr<components::ErrorDialogBase> TodoAndTimeCardApp::_error_dialog{
         components::ErrorDialog([] { _show_error_dialog = false; })
     };
     bool TodoAndTimeCardApp::_show_error_dialog{false};
+    std::thread TodoAndTimeCardApp::_frame_thread;
+    std::mutex TodoAndTimeCardApp::_frame_mtx;
+    std::condition_variable TodoAndTimeCardApp::_frame_condition;
+    bool TodoAndTimeCardApp::_redraw_requested{false};
+    bool TodoAndTimeCardApp::_frame_loop{false};
+    unsigned long long TodoAndTimeCardApp::_input_generation{0};
+    std::mutex TodoAndTimeCardApp::_post_mtx;
+    std::deque<std::function<void()>> TodoAndTimeCardApp::_posted_jobs;
+    bool TodoAndTimeCardApp::_loop_ended{false};
 } // core
@@ -31,6 +31,12 @@
 
 #ifndef TODOANDTIMECARDAPP_H
 #define TODOANDTIMECARDAPP_H
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include "../components/ErrorDialogBase.h"
 #include "../page/TodoListPage.h"
 
@@ -41,19 +47,74 @@ namespace core {
 
         static void execute();
 
+        /**
+         * @brief 画面の再描画を要求します。どのスレッドからでも呼び出せます。
+         * @details 要求はフレームスケジューラがまとめ、前回の描画から1フレーム分の時間が経過した後に1回だけ描画します。
+         * そのため、短時間に何度呼び出しても、描画は最大フレームレート(MAX_FRAMES_PER_SECOND)を超えません。
+         */
         static void updateScreen();
 
+        /**
+         * @brief fn_をUIスレッドで実行し、画面を更新します。他のスレッドからUIの状態を変更する場合に使用してください。
+         * @details 画面の終了後に渡された処理、および終了時に実行されていなかった処理は、execute()の終了処理で実行します。
+         * @param fn_ UIスレッドで実行する処理
+         */
+        static void post(std::function<void()> fn_);
+
         static void setError(const std::string& msg);
 
         static void show();
 
         static void close();
 
+        /**
+         * @brief ユーザーの入力(Event::Custom以外のイベント)を受け取るたびに増加する値を取得します。
+         * @details 入力はフォーカスや選択状態を変えるため、描画結果を再利用するコンポーネントはこの値の変化で作り直します。
+         * 値が変わらない間の描画は、ティックやワーカースレッドからの再描画要求によるものです。
+         */
+        static unsigned long long getInputGeneration();
+
     private:
+        /**
+         * @brief 再描画の要求を待ち、最大フレームレートに合わせて画面へイベントを送信します。
+         */
+        static void _frameThreadProcess();
+
+        static void _startFrameScheduler();
+
+        static void _stopFrameScheduler();
+
+        /**
+         * @brief post()で渡された処理のうち、実行されていないものを全て実行します。
+         */
+        static void _runPostedJobs();
+
+        /**
+         * @brief 画面の終了後に、データベース操作とUIスレッドへ渡された処理がなくなるまで実行します。
+         * @details データベース操作の完了を待っているコルーチンを最後まで進め、破棄されずに残ることを防ぎます。
+         */
+        static void _drainAfterLoop();
+
+        static constexpr int MAX_FRAMES_PER_SECOND = 30;
+        static constexpr std::chrono::milliseconds FRAME_INTERVAL{1000 / MAX_FRAMES_PER_SECOND};
+
         static std::mutex _screen_mutex;
         static ftxui::ScreenInteractive _screen;
         static std::shared_ptr<components::ErrorDialogBase> _error_dialog;
         static bool _show_error_dialog;
+
+        // フレームスケジューラ関係
+        static std::thread _frame_thread;
+        static std::mutex _frame_mtx;
+        static std::condition_variable _frame_condition;
+        static bool _redraw_requested;
+        static bool _frame_loop;
+        static unsigned long long _input_generation;
+
+        // UIスレッドへ渡された処理
+        static std::mutex _post_mtx;
+        static std::deque<std::function<void()>> _posted_jobs;
+        static bool _loop_ended;
     };
 } // core
 
@@ -22,7 +22,15 @@
 
 #include "PageDecorator.h"
 
+#include <algorithm>
+#include <ftxui/screen/terminal.hpp>
+
+int decorator::pageHeight()
+{
+    return std::max(MIN_PAGE_HEIGHT, ftxui::Terminal::Size().dimy - PAGE_FOOTER_ROWS);
+}
+
 ftxui::Element decorator::pageDecorator(const ftxui::Element& element_)
 {
-    return element_ | size(ftxui::HEIGHT, ftxui::EQUAL, 28) | size(ftxui::WIDTH, ftxui::EQUAL, 118);
+    return element_ | size(ftxui::HEIGHT, ftxui::EQUAL, pageHeight()) | size(ftxui::WIDTH, ftxui::EQUAL, 118);
 }
@@ -34,7 +34,18 @@
 #include <ftxui/dom/elements.hpp>
 
 namespace decorator {
+    /**
+     * @brief ページの高さを取得します。
+     * @details 端末の高さからタブの切り替えメニューの分を除いた高さです。MIN_PAGE_HEIGHT未満にはなりません。
+     */
+    int pageHeight();
+
     ftxui::Element pageDecorator(const ftxui::Element& element_);
+
+    // ページの高さの最小値
+    constexpr int MIN_PAGE_HEIGHT = 28;
+    // ページの下に表示する、区切り線とタブの切り替えメニューの行数
+    constexpr int PAGE_FOOTER_ROWS = 2;
 }
 
 #endif //PAGEDECORATOR_H
@@ -25,7 +25,11 @@
 
 #include "resource.h"
 #include "core/DBManager.h"
+#include "core/DBPerformanceProfile.h"
 #include "core/Logger.h"
+#include "core/QueryPlanAuditor.h"
+#include "core/QueryStats.h"
+#include "core/SettingsStore.h"
 #include "core/TodoAndTimeCardApp.h"
 
 class ApplicationStartEndLogger {
@@ -42,11 +46,23 @@ void startup()
     if (!core::db::DBManager::setDBFile("dev.sqlite")) {
         Logger::error("Failed to change database file path.", "main");
     }
+    // デバッグビルドでは、クエリプランの監査を常に有効にする。
+    core::db::QueryPlanAuditor::setEnabled(true);
 #endif
     Logger::loadFromSettings();
+    core::db::DBManager::loadQueryLogSettings();
+    // 設定画面で変更された設定値を、SettingsStoreからの通知で反映する。
+    core::SettingsStore::subscribe("log level", Logger::loadFromSettings);
+    core::SettingsStore::subscribe("query log level", Logger::loadFromSettings);
+    core::SettingsStore::subscribe("query log sampling", core::db::DBManager::loadQueryLogSettings);
+    core::SettingsStore::subscribe("slow query threshold", core::db::DBManager::loadQueryLogSettings);
+    for (const auto& key : core::db::DBPerformanceProfile::getSettingKeys()) {
+        core::SettingsStore::subscribe(key, [] { core::db::DBPerformanceProfile::apply(); });
+    }
     Logger::initialize();
     ApplicationStartEndLogger logger;
     core::TodoAndTimeCardApp::execute();
+    if (core::db::QueryPlanAuditor::isEnabled()) core::db::QueryPlanAuditor::writeReport();
 }
 
 bool executeOption(std::vector<std::string> args)
@@ -64,6 +80,8 @@ bool executeOption(std::vector<std::string> args)
             else if (option == "--help") {
                 std::cout << R"(Usage:
     todo-and-timecard-tui           : Start the software.
+    todo-and-timecard-tui --db-stats : Start the software and show the query statistics on exit.
+    todo-and-timecard-tui --query-plan-audit : Start the software and log the queries that scan whole tables.
     todo-and-timecard-tui --version : Show the software version.
     todo-and-timecard-tui --license : Show the license.
     todo-and-timecard-tui --notice  : Show the contents of the Notice file.)"
@@ -82,6 +100,11 @@ int main(const int argc, char** argv)
 {
     const std::vector<std::string> args(argv, argv + argc);
     if (executeOption(args)) return 0;
+    if (std::ranges::find(args, "--query-plan-audit") != args.end()) core::db::QueryPlanAuditor::setEnabled(true);
+    // クエリ統計は全ての文の実行に計測の負荷がかかるため、要求された場合のみ記録する。
+    const bool show_db_stats = std::ranges::find(args, "--db-stats") != args.end();
+    if (show_db_stats) core::db::QueryStats::setEnabled(true);
     startup();
+    if (show_db_stats) { std::cout << core::db::QueryStats::format() << std::endl; }
     return 0;
 }
@@ -0,0 +1,89 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "DiagnosticsPage.h"
+
+#include <format>
+#include <ftxui/dom/elements.hpp>
+
+#include "../core/QueryStats.h"
+
+namespace pages {
+    namespace {
+        ftxui::Element cell(const std::string& value_, const int width_)
+        {
+            return ftxui::text(value_) | ftxui::size(ftxui::WIDTH, ftxui::EQUAL, width_);
+        }
+
+        ftxui::Element row(const std::vector<std::string>& values_, const std::string& sql_)
+        {
+            ftxui::Elements cells;
+            for (const auto& value : values_) { cells.emplace_back(cell(value, 10)); }
+            cells.emplace_back(ftxui::text(sql_) | ftxui::flex);
+            return ftxui::hbox(cells);
+        }
+    }
+
+    DiagnosticsPage::DiagnosticsPage()
+    {
+        _reset_button = ftxui::Button("Reset", [] { core::db::QueryStats::reset(); }, ftxui::ButtonOption::Ascii());
+        // 記録の有効・無効を切り替える。ラベルは現在の状態に合わせて書き換える。
+        _toggle_label = core::db::QueryStats::isEnabled() ? "Disable" : "Enable";
+        _toggle_button = ftxui::Button(&_toggle_label, [&] {
+            core::db::QueryStats::setEnabled(!core::db::QueryStats::isEnabled());
+            _toggle_label = core::db::QueryStats::isEnabled() ? "Disable" : "Enable";
+        }, ftxui::ButtonOption::Ascii());
+        _container = ftxui::Container::Horizontal({_toggle_button, _reset_button});
+    }
+
+    ftxui::Component DiagnosticsPage::getComponent() const
+    {
+        return Renderer(_container, [&] {
+            ftxui::Elements rows;
+            rows.emplace_back(row({"calls", "total ms", "mean ms", "p50 ms", "p99 ms", "rows", "changed", "vm steps",
+                                   "sorts"}, "sql") | ftxui::bold);
+            rows.emplace_back(ftxui::separator());
+            size_t count = 0;
+            for (const auto& summary : core::db::QueryStats::collect()) {
+                if (count++ >= MAX_DISPLAY_STATEMENTS) break;
+                rows.emplace_back(row({
+                                          std::to_string(summary.calls),
+                                          std::format("{:.2f}", summary.total_ms),
+                                          std::format("{:.3f}", summary.mean_ms),
+                                          std::format("{:.3f}", summary.p50_ms),
+                                          std::format("{:.3f}", summary.p99_ms),
+                                          std::to_string(summary.rows_returned),
+                                          std::to_string(summary.rows_changed),
+                                          std::to_string(summary.vm_steps),
+                                          std::to_string(summary.sorts)
+                                      }, summary.sql));
+            }
+            return ftxui::vbox(
+                ftxui::hbox(ftxui::text("Query statistics") | ftxui::vcenter,
+                            core::db::QueryStats::isEnabled() ? ftxui::text("") : ftxui::text(" (disabled)") | ftxui::dim,
+                            ftxui::filler(), _toggle_button->Render(), ftxui::text(" "), _reset_button->Render()),
+                ftxui::separator(),
+                ftxui::vbox(rows) | ftxui::yflex_grow | ftxui::frame | ftxui::vscroll_indicator
+            );
+        });
+    }
+} // pages
@@ -0,0 +1,61 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/**
+ * @file DiagnosticsPage.h
+ * @date 26/10/16
+ * @brief クエリ統計を表示するページ
+ * @details QueryStatsの集計結果を、合計実行時間の多い順に表示します。
+ * @author saku shirakura (saku@sakushira.com)
+ */
+
+
+#ifndef DIAGNOSTICSPAGE_H
+#define DIAGNOSTICSPAGE_H
+#include <ftxui/component/component.hpp>
+
+#include "Page.h"
+
+namespace pages {
+    /**
+     * @brief sql文ごとのクエリ統計を表示します。
+     * @details 描画のたびに集計結果を取得するため、表示中は最新の値が反映されます。
+     * @details 記録は既定で無効であり、このページのボタンまたは--db-statsで有効にします。
+     */
+    class DiagnosticsPage final : public Page {
+    public:
+        DiagnosticsPage();
+
+        [[nodiscard]] ftxui::Component getComponent() const;
+
+    private:
+        // 表示するsql文の最大数
+        static constexpr size_t MAX_DISPLAY_STATEMENTS = 50;
+
+        std::string _toggle_label;
+        ftxui::Component _toggle_button;
+        ftxui::Component _reset_button;
+        ftxui::Component _container;
+    };
+} // pages
+
+#endif //DIAGNOSTICSPAGE_H
@@ -33,6 +33,7 @@
 #define PAGEMANAGER_H
 #include <ftxui/component/component.hpp>
 
+#include "DiagnosticsPage.h"
 #include "SettingsPage.h"
 #include "WorktimeSummaryPage.h"
 #include "TodoListPage.h"
@@ -62,6 +63,7 @@ namespace pages {
         TodoListPage _todo_list_page{};
         WorktimeSummaryPage _worktime_summary_page{};
         SettingsPage _settings_page{};
+        DiagnosticsPage _diagnostics_page{};
     };
 }
 #endif //PAGEMANAGER_H
@@ -24,7 +24,8 @@
 
 #include <ftxui/dom/elements.hpp>
 
-#include "../core/Logger.h"
+#include "../core/DBPerformanceProfile.h"
+#include "../core/SettingsStore.h"
 
 namespace pages {
     SettingsPage::SettingsPage()
@@ -65,7 +66,28 @@ namespace pages {
                                                         "error",
                                                         "critical"
                                                     }));
-        _entries.back()->setOnChange([&](std::string p, std::string v) { Logger::loadFromSettings(); });
+        _entries.push_back(SettingEntryImpl::create("query log level", {
+                                                        "inherit",
+                                                        "debug",
+                                                        "off"
+                                                    }));
+        _entries.push_back(SettingEntryImpl::create("query log sampling", {
+                                                        "1",
+                                                        "10",
+                                                        "100",
+                                                        "1000"
+                                                    }));
+        _entries.push_back(SettingEntryImpl::create("slow query threshold", {
+                                                        "off",
+                                                        "10",
+                                                        "50",
+                                                        "100",
+                                                        "500"
+                                                    }));
+
+        for (const auto& key : core::db::DBPerformanceProfile::getSettingKeys()) {
+            _entries.push_back(SettingEntryImpl::create(key, core::db::DBPerformanceProfile::getSelections(key)));
+        }
 
         _container = ftxui::Container::Vertical({});
         for (size_t i = 0; i < _entries.size(); i++) { _container->Add(_entries.at(i)); }
@@ -81,15 +103,6 @@ namespace pages {
         });
     }
 
-    void SettingsPage::registerEventOnChange(const std::string& trigger_setting_key_, std::function<void()> function_)
-    {
-        if (!function_) return;
-        if (!_event_setting_changed.contains(trigger_setting_key_)) {
-            _event_setting_changed.try_emplace(trigger_setting_key_, std::vector{function_});
-        }
-        else { _event_setting_changed.at(trigger_setting_key_).emplace_back(function_); }
-    }
-
     std::shared_ptr<SettingsPage::SettingEntryImpl> SettingsPage::SettingEntryImpl::create(
         std::string setting_key_, std::vector<std::string> menu_entry_)
     {
@@ -114,35 +127,20 @@ namespace pages {
     {
         ftxui::DropdownOption option{};
         if (!_selections.empty()) {
-            core::db::SettingTable tbl{};
-            tbl.selectRecords("setting_key = ?", {
-                                  {core::db::ColType::T_TEXT, _setting_key}
-                              });
-
-            if (!tbl.getKeys().empty())
-                if (const auto i = std::ranges::find(_selections, tbl.getTable().at(tbl.getKeys().front()).value);
+            const auto settings = core::SettingsStore::snapshot();
+            if (settings->values.contains(_setting_key)) {
+                if (const auto i = std::ranges::find(_selections, settings->value(_setting_key));
                     i == _selections.end()) { _selection_selected = 0; }
                 else { _selection_selected = std::distance(_selections.begin(), i); }
+            }
         }
         option.radiobox.on_change = [&] {
             if (_selection_selected >= 0 && _selection_selected < _selections.size()) {
                 const std::string prev = _setting_value;
                 _setting_value = _selections.at(_selection_selected);
-                core::db::NoMappingTable tbl;
-                tbl.usePlaceholderUniSql("UPDATE settings SET value = ? WHERE setting_key = ?;", {
-                                             {
-                                                 core::db::ColType::T_TEXT,
-                                                 _setting_value
-                                             },
-                                             {
-                                                 core::db::ColType::T_TEXT,
-                                                 _setting_key
-                                             }
-                                         });
+                // 設定値に依存する処理には、SettingsStoreから通知される。
+                if (core::SettingsStore::set(_setting_key, _setting_value) != 0) return;
                 if (_on_change) _on_change(prev, _setting_value);
-                if (_event_setting_changed.contains(_setting_key)) {
-                    for (const auto event : _event_setting_changed.at(_setting_key)) { event(); }
-                }
             }
         };
         option.radiobox.entries = &_selections;
@@ -151,6 +149,4 @@ namespace pages {
         _component = ftxui::Dropdown(option);
         Add(_component);
     }
-
-    std::unordered_map<std::string, std::vector<std::function<void ()>>> SettingsPage::_event_setting_changed{};
 } // pages
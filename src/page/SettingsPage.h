@@ -49,8 +49,6 @@ namespace pages {
 
         ftxui::Component getComponent() const;
 
-        static void registerEventOnChange(const std::string& trigger_setting_key_, std::function<void()> function_);
-
     private:
         class SettingEntryImpl final : public ftxui::ComponentBase {
         public:
@@ -74,7 +72,6 @@ namespace pages {
 
         ftxui::Component _container;
         std::vector<std::shared_ptr<SettingEntryImpl>> _entries{};
-        static std::unordered_map<std::string, std::vector<std::function<void()>>> _event_setting_changed;
     };
 } // pages
 
@@ -120,28 +120,14 @@ const char F_VERSION_[] = {118, 48, 46, 48, 46, 50, 45, 97, 108, 112, 104, 97};
 
 
 // is_task_siblings.sql
-const unsigned long long SIZE_IS_TASK_SIBLINGS_SQL = 552;
+const unsigned long long SIZE_IS_TASK_SIBLINGS_SQL = 143;
 const char F_IS_TASK_SIBLINGS_SQL[] = {
-    87, 73, 84, 72, 32, 82, 69, 67, 85, 82, 83, 73, 86, 69, 32, 104, 105, 101, 114, 97, 114, 99, 104, 121, 95, 116, 97,
-    98, 108, 101, 32, 65, 83, 32, 40, 83, 69, 76, 69, 67, 84, 32, 105, 100, 44, 32, 112, 97, 114, 101, 110, 116, 95,
-    105, 100, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 10, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 87, 72,
-    69, 82, 69, 32, 105, 100, 32, 61, 32, 63, 50, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 85, 78, 73, 79, 78, 32, 65, 76, 76, 10,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 83, 69, 76, 69, 67, 84, 32, 66, 46, 105, 100, 44, 32, 66, 46, 112, 97, 114, 101, 110, 116,
-    95, 105, 100, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70, 82, 79, 77, 32, 104, 105, 101, 114, 97, 114, 99, 104, 121, 95, 116,
-    97, 98, 108, 101, 32, 65, 83, 32, 65, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 73, 78, 78,
-    69, 82, 32, 74, 79, 73, 78, 32, 116, 97, 115, 107, 32, 65, 83, 32, 66, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 87, 72, 69, 82,
-    69, 32, 66, 46, 112, 97, 114, 101, 110, 116, 95, 105, 100, 32, 61, 32, 65, 46, 105, 100, 41, 10, 83, 69, 76, 69, 67,
-    84, 32, 69, 88, 73, 83, 84, 83, 32, 40, 83, 69, 76, 69, 67, 84, 32, 49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 70, 82, 79, 77, 32, 104, 105, 101, 114, 97, 114, 99, 104, 121, 95, 116, 97, 98, 108, 101, 10,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 105, 100, 32, 61, 32, 63, 49,
-    41, 32, 65, 83, 32, 114, 101, 115, 117, 108, 116, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+    83, 69, 76, 69, 67, 84, 32, 69, 88, 73, 83, 84, 83, 32, 40, 83, 69, 76, 69, 67, 84, 32, 49, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 97, 110, 99, 101, 115, 116,
+    111, 114, 32, 61, 32, 63, 50, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 65, 78, 68,
+    32, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 32, 61, 32, 63, 49, 41, 32, 65, 83, 32, 114, 101, 115, 117, 108,
+    116, 59, 0, 0, 0
 };
 
 
@@ -164,7 +150,7 @@ const char F_CHANGE_TO_ONLY_ONE_TASK_SQL[] = {
 
 // MIGRATE_LATEST
 const unsigned long long SIZE_MIGRATE_LATEST_ = 1;
-const char F_MIGRATE_LATEST_[] = {49};
+const char F_MIGRATE_LATEST_[] = {56};
 
 
 // initialize_db.sql
@@ -308,23 +294,37 @@ const char F_INITIALIZE_DB_SQL[] = {
 
 
 // gantt_tasks_from_duration.sql
-const unsigned long long SIZE_GANTT_TASKS_FROM_DURATION_SQL = 389;
+const unsigned long long SIZE_GANTT_TASKS_FROM_DURATION_SQL = 745;
 const char F_GANTT_TASKS_FROM_DURATION_SQL[] = {
-    83, 69, 76, 69, 67, 84, 32, 105, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 116, 97, 115, 107, 95, 105, 100, 44, 10,
-    32, 32, 32, 32, 32, 32, 32, 109, 105, 110, 40, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 41,
-    32, 32, 65, 83, 32, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 44, 10, 32, 32, 32, 32, 32, 32,
-    32, 109, 97, 120, 40, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 41, 32, 65, 83, 32, 102,
-    105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 99, 114, 101,
-    97, 116, 101, 100, 95, 97, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 117, 112, 100, 97, 116, 101, 100, 95, 97, 116,
-    10, 70, 82, 79, 77, 32, 110, 117, 108, 108, 95, 115, 101, 116, 95, 119, 111, 114, 107, 116, 105, 109, 101, 10, 87,
-    72, 69, 82, 69, 32, 40, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 32, 60, 32, 63, 49, 32, 65,
-    78, 68, 32, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 32, 62, 32, 63, 50, 41, 10, 32, 32,
-    32, 79, 82, 32, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 32, 66, 69, 84, 87, 69, 69, 78, 32,
-    63, 49, 32, 65, 78, 68, 32, 63, 50, 10, 32, 32, 32, 79, 82, 32, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95,
-    116, 105, 109, 101, 32, 66, 69, 84, 87, 69, 69, 78, 32, 63, 49, 32, 65, 78, 68, 32, 63, 50, 10, 71, 82, 79, 85, 80,
-    32, 66, 89, 32, 116, 97, 115, 107, 95, 105, 100, 10, 79, 82, 68, 69, 82, 32, 66, 89, 32, 115, 116, 97, 114, 116,
-    105, 110, 103, 95, 116, 105, 109, 101, 44, 32, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 32,
-    45, 32, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+    83, 69, 76, 69, 67, 84, 32, 119, 111, 114, 107, 116, 105, 109, 101, 46, 105, 100, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 119, 111, 114, 107, 116, 105, 109, 101, 46, 116, 97, 115, 107, 95, 105, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    109, 105, 110, 40, 119, 111, 114, 107, 116, 105, 109, 101, 46, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105,
+    109, 101, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 65, 83, 32, 115, 116, 97, 114, 116, 105,
+    110, 103, 95, 116, 105, 109, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 109, 97, 120, 40, 99, 111, 97, 108, 101, 115,
+    99, 101, 40, 119, 111, 114, 107, 116, 105, 109, 101, 46, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105,
+    109, 101, 44, 32, 117, 110, 105, 120, 101, 112, 111, 99, 104, 40, 68, 65, 84, 69, 84, 73, 77, 69, 40, 39, 110, 111,
+    119, 39, 41, 41, 41, 41, 32, 65, 83, 32, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 119, 111, 114, 107, 116, 105, 109, 101, 46, 99, 114, 101, 97, 116, 101, 100, 95, 97,
+    116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 119, 111, 114, 107, 116, 105, 109, 101, 46, 117, 112, 100, 97, 116, 101,
+    100, 95, 97, 116, 10, 70, 82, 79, 77, 32, 119, 111, 114, 107, 116, 105, 109, 101, 95, 114, 116, 114, 101, 101, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 73, 78, 78, 69, 82, 32, 74, 79, 73, 78, 32, 119, 111, 114, 107, 116, 105, 109,
+    101, 32, 79, 78, 32, 119, 111, 114, 107, 116, 105, 109, 101, 46, 105, 100, 32, 61, 32, 119, 111, 114, 107, 116, 105,
+    109, 101, 95, 114, 116, 114, 101, 101, 46, 105, 100, 10, 87, 72, 69, 82, 69, 32, 119, 111, 114, 107, 116, 105, 109,
+    101, 95, 114, 116, 114, 101, 101, 46, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 32, 60, 32, 63,
+    50, 10, 32, 32, 65, 78, 68, 32, 119, 111, 114, 107, 116, 105, 109, 101, 95, 114, 116, 114, 101, 101, 46, 102, 105,
+    110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 32, 62, 32, 63, 49, 10, 32, 32, 65, 78, 68, 32, 119, 111,
+    114, 107, 116, 105, 109, 101, 46, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 32, 60, 32, 63, 50,
+    10, 32, 32, 65, 78, 68, 32, 99, 111, 97, 108, 101, 115, 99, 101, 40, 119, 111, 114, 107, 116, 105, 109, 101, 46,
+    102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 44, 32, 117, 110, 105, 120, 101, 112, 111, 99,
+    104, 40, 68, 65, 84, 69, 84, 73, 77, 69, 40, 39, 110, 111, 119, 39, 41, 41, 41, 32, 62, 32, 63, 49, 10, 71, 82, 79,
+    85, 80, 32, 66, 89, 32, 119, 111, 114, 107, 116, 105, 109, 101, 46, 116, 97, 115, 107, 95, 105, 100, 10, 79, 82, 68,
+    69, 82, 32, 66, 89, 32, 109, 105, 110, 40, 119, 111, 114, 107, 116, 105, 109, 101, 46, 115, 116, 97, 114, 116, 105,
+    110, 103, 95, 116, 105, 109, 101, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 109, 105, 110, 40, 119, 111, 114,
+    107, 116, 105, 109, 101, 46, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 41, 32, 45, 32, 109, 97,
+    120, 40, 99, 111, 97, 108, 101, 115, 99, 101, 40, 119, 111, 114, 107, 116, 105, 109, 101, 46, 102, 105, 110, 105,
+    115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 44, 32, 117, 110, 105, 120, 101, 112, 111, 99, 104, 40, 68, 65, 84,
+    69, 84, 73, 77, 69, 40, 39, 110, 111, 119, 39, 41, 41, 41, 41, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
 };
 
 
@@ -404,36 +404,517 @@ const char F_SELECT_ACTIVE_TASK_SQL[] = {
 
 
 // sum_total_worktime.sql
-const unsigned long long SIZE_SUM_TOTAL_WORKTIME_SQL = 757;
+const unsigned long long SIZE_SUM_TOTAL_WORKTIME_SQL = 108;
 const char F_SUM_TOTAL_WORKTIME_SQL[] = {
-    83, 69, 76, 69, 67, 84, 32, 67, 79, 65, 76, 69, 83, 67, 69, 40, 83, 85, 77, 40, 116, 111, 116, 97, 108, 95, 119,
-    111, 114, 107, 116, 105, 109, 101, 41, 44, 32, 48, 41, 32, 65, 83, 32, 116, 111, 116, 97, 108, 95, 119, 111, 114,
-    107, 116, 105, 109, 101, 10, 70, 82, 79, 77, 32, 116, 111, 116, 97, 108, 95, 119, 111, 114, 107, 116, 105, 109, 101,
-    95, 103, 114, 111, 117, 112, 95, 98, 121, 95, 116, 97, 115, 107, 10, 87, 72, 69, 82, 69, 32, 116, 97, 115, 107, 95,
-    105, 100, 32, 73, 78, 32, 40, 87, 73, 84, 72, 32, 82, 69, 67, 85, 82, 83, 73, 86, 69, 32, 104, 105, 101, 114, 97,
-    114, 99, 104, 121, 95, 116, 97, 98, 108, 101, 32, 65, 83, 32, 40, 83, 69, 76, 69, 67, 84, 32, 105, 100, 44, 32, 112,
-    97, 114, 101, 110, 116, 95, 105, 100, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    83, 69, 76, 69, 67, 84, 32, 67, 79, 65, 76, 69, 83, 67, 69, 40, 40, 83, 69, 76, 69, 67, 84, 32, 115, 117, 98, 116,
+    114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 119, 111,
+    114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 32, 87, 72, 69, 82, 69, 32, 116, 97, 115, 107, 95, 105,
+    100, 32, 61, 32, 63, 49, 41, 44, 32, 48, 41, 32, 65, 83, 32, 116, 111, 116, 97, 108, 95, 119, 111, 114, 107, 116,
+    105, 109, 101, 59
+};
+
+
+// mig_v2.sql
+const unsigned long long SIZE_MIG_V2_SQL = 204;
+const char F_MIG_V2_SQL[] = {
+    73, 78, 83, 69, 82, 84, 32, 73, 78, 84, 79, 32, 115, 101, 116, 116, 105, 110, 103, 115, 40, 115, 101, 116, 116, 105,
+    110, 103, 95, 107, 101, 121, 44, 32, 118, 97, 108, 117, 101, 41, 10, 86, 65, 76, 85, 69, 83, 32, 40, 39, 113, 117,
+    101, 114, 121, 32, 108, 111, 103, 32, 108, 101, 118, 101, 108, 39, 44, 32, 39, 105, 110, 104, 101, 114, 105, 116,
+    39, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 40, 39, 113, 117, 101, 114, 121, 32, 108, 111, 103, 32, 115, 97, 109,
+    112, 108, 105, 110, 103, 39, 44, 32, 39, 49, 39, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 40, 39, 115, 108, 111, 119,
+    32, 113, 117, 101, 114, 121, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 39, 44, 32, 39, 111, 102, 102, 39, 41,
+    59, 10, 10, 73, 78, 83, 69, 82, 84, 32, 73, 78, 84, 79, 32, 109, 105, 103, 114, 97, 116, 101, 32, 40, 97, 112, 112,
+    108, 105, 101, 100, 41, 10, 86, 65, 76, 85, 69, 83, 32, 40, 50, 41, 59, 0, 0, 0, 0, 0, 0
+};
+
+
+// mig_v3.sql
+const unsigned long long SIZE_MIG_V3_SQL = 300;
+const char F_MIG_V3_SQL[] = {
+    73, 78, 83, 69, 82, 84, 32, 73, 78, 84, 79, 32, 115, 101, 116, 116, 105, 110, 103, 115, 40, 115, 101, 116, 116, 105,
+    110, 103, 95, 107, 101, 121, 44, 32, 118, 97, 108, 117, 101, 41, 10, 86, 65, 76, 85, 69, 83, 32, 40, 39, 106, 111,
+    117, 114, 110, 97, 108, 32, 109, 111, 100, 101, 39, 44, 32, 39, 119, 97, 108, 39, 41, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 40, 39, 115, 121, 110, 99, 104, 114, 111, 110, 111, 117, 115, 39, 44, 32, 39, 110, 111, 114, 109, 97, 108,
+    39, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 40, 39, 99, 97, 99, 104, 101, 32, 115, 105, 122, 101, 32, 40, 75, 105,
+    66, 41, 39, 44, 32, 39, 56, 49, 57, 50, 39, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 40, 39, 109, 109, 97, 112, 32,
+    115, 105, 122, 101, 32, 40, 77, 105, 66, 41, 39, 44, 32, 39, 54, 52, 39, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 40,
+    39, 116, 101, 109, 112, 32, 115, 116, 111, 114, 101, 39, 44, 32, 39, 109, 101, 109, 111, 114, 121, 39, 41, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 40, 39, 98, 117, 115, 121, 32, 116, 105, 109, 101, 111, 117, 116, 32, 40, 109, 115, 41,
+    39, 44, 32, 39, 53, 48, 48, 48, 39, 41, 59, 10, 10, 73, 78, 83, 69, 82, 84, 32, 73, 78, 84, 79, 32, 109, 105, 103,
+    114, 97, 116, 101, 32, 40, 97, 112, 112, 108, 105, 101, 100, 41, 10, 86, 65, 76, 85, 69, 83, 32, 40, 51, 41, 59, 0,
+    0, 0, 0, 0, 0, 0, 0, 0
+};
+
+
+// mig_v4.sql
+const unsigned long long SIZE_MIG_V4_SQL = 2386;
+const char F_MIG_V4_SQL[] = {
+    68, 82, 79, 80, 32, 84, 82, 73, 71, 71, 69, 82, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 116, 114, 105, 103, 103,
+    101, 114, 95, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 95, 105, 110, 115, 101, 114, 116, 59, 10, 68,
+    82, 79, 80, 32, 84, 82, 73, 71, 71, 69, 82, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 116, 114, 105, 103, 103,
+    101, 114, 95, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 95, 100, 101, 108, 101, 116, 101, 59, 10, 68,
+    82, 79, 80, 32, 84, 82, 73, 71, 71, 69, 82, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 116, 114, 105, 103, 103,
+    101, 114, 95, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 95, 114, 101, 112, 97, 114, 101, 110, 116,
+    59, 10, 68, 82, 79, 80, 32, 73, 78, 68, 69, 88, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 105, 100, 120, 95, 116,
+    97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 95, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 59, 10, 68,
+    82, 79, 80, 32, 84, 65, 66, 76, 69, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 116, 97, 115, 107, 95, 99, 108, 111,
+    115, 117, 114, 101, 59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 84, 65, 66, 76, 69, 32, 116, 97, 115, 107, 95, 99, 108,
+    111, 115, 117, 114, 101, 10, 40, 10, 32, 32, 32, 32, 97, 110, 99, 101, 115, 116, 111, 114, 32, 32, 32, 73, 78, 84,
+    69, 71, 69, 82, 32, 78, 79, 84, 32, 78, 85, 76, 76, 44, 10, 32, 32, 32, 32, 100, 101, 115, 99, 101, 110, 100, 97,
+    110, 116, 32, 73, 78, 84, 69, 71, 69, 82, 32, 78, 79, 84, 32, 78, 85, 76, 76, 44, 10, 32, 32, 32, 32, 100, 101, 112,
+    116, 104, 32, 32, 32, 32, 32, 32, 73, 78, 84, 69, 71, 69, 82, 32, 78, 79, 84, 32, 78, 85, 76, 76, 44, 10, 32, 32,
+    32, 32, 80, 82, 73, 77, 65, 82, 89, 32, 75, 69, 89, 32, 40, 97, 110, 99, 101, 115, 116, 111, 114, 44, 32, 100, 101,
+    115, 99, 101, 110, 100, 97, 110, 116, 41, 10, 41, 32, 87, 73, 84, 72, 79, 85, 84, 32, 82, 79, 87, 73, 68, 59, 10,
+    10, 67, 82, 69, 65, 84, 69, 32, 73, 78, 68, 69, 88, 32, 105, 100, 120, 95, 116, 97, 115, 107, 95, 99, 108, 111, 115,
+    117, 114, 101, 95, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 32, 79, 78, 32, 116, 97, 115, 107, 95, 99, 108,
+    111, 115, 117, 114, 101, 32, 40, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 44, 32, 100, 101, 112, 116, 104,
+    41, 59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 84, 82, 73, 71, 71, 69, 82, 32, 116, 114, 105, 103, 103, 101, 114, 95,
+    116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 95, 105, 110, 115, 101, 114, 116, 10, 32, 32, 32, 32, 65,
+    70, 84, 69, 82, 32, 73, 78, 83, 69, 82, 84, 10, 32, 32, 32, 32, 79, 78, 32, 116, 97, 115, 107, 10, 66, 69, 71, 73,
+    78, 10, 32, 32, 32, 32, 73, 78, 83, 69, 82, 84, 32, 73, 78, 84, 79, 32, 116, 97, 115, 107, 95, 99, 108, 111, 115,
+    117, 114, 101, 40, 97, 110, 99, 101, 115, 116, 111, 114, 44, 32, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 44,
+    32, 100, 101, 112, 116, 104, 41, 10, 32, 32, 32, 32, 86, 65, 76, 85, 69, 83, 32, 40, 78, 69, 87, 46, 105, 100, 44,
+    32, 78, 69, 87, 46, 105, 100, 44, 32, 48, 41, 59, 10, 32, 32, 32, 32, 73, 78, 83, 69, 82, 84, 32, 73, 78, 84, 79,
+    32, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 40, 97, 110, 99, 101, 115, 116, 111, 114, 44, 32, 100,
+    101, 115, 99, 101, 110, 100, 97, 110, 116, 44, 32, 100, 101, 112, 116, 104, 41, 10, 32, 32, 32, 32, 83, 69, 76, 69,
+    67, 84, 32, 97, 110, 99, 101, 115, 116, 111, 114, 44, 32, 78, 69, 87, 46, 105, 100, 44, 32, 100, 101, 112, 116, 104,
+    32, 43, 32, 49, 10, 32, 32, 32, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 10,
+    32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 32, 61, 32, 78, 69, 87, 46,
+    112, 97, 114, 101, 110, 116, 95, 105, 100, 59, 10, 69, 78, 68, 59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 84, 82, 73,
+    71, 71, 69, 82, 32, 116, 114, 105, 103, 103, 101, 114, 95, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101,
+    95, 100, 101, 108, 101, 116, 101, 10, 32, 32, 32, 32, 65, 70, 84, 69, 82, 32, 68, 69, 76, 69, 84, 69, 10, 32, 32,
+    32, 32, 79, 78, 32, 116, 97, 115, 107, 10, 66, 69, 71, 73, 78, 10, 32, 32, 32, 32, 68, 69, 76, 69, 84, 69, 10, 32,
+    32, 32, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 10, 32, 32, 32, 32, 87, 72,
+    69, 82, 69, 32, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 32, 73, 78, 32, 40, 83, 69, 76, 69, 67, 84, 32, 100,
+    101, 115, 99, 101, 110, 100, 97, 110, 116, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117,
+    114, 101, 32, 87, 72, 69, 82, 69, 32, 97, 110, 99, 101, 115, 116, 111, 114, 32, 61, 32, 79, 76, 68, 46, 105, 100,
+    41, 59, 10, 69, 78, 68, 59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 84, 82, 73, 71, 71, 69, 82, 32, 116, 114, 105, 103,
+    103, 101, 114, 95, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 95, 114, 101, 112, 97, 114, 101, 110,
+    116, 10, 32, 32, 32, 32, 65, 70, 84, 69, 82, 32, 85, 80, 68, 65, 84, 69, 32, 79, 70, 32, 112, 97, 114, 101, 110,
+    116, 95, 105, 100, 10, 32, 32, 32, 32, 79, 78, 32, 116, 97, 115, 107, 10, 32, 32, 32, 32, 87, 72, 69, 78, 32, 79,
+    76, 68, 46, 112, 97, 114, 101, 110, 116, 95, 105, 100, 32, 73, 83, 32, 78, 79, 84, 32, 78, 69, 87, 46, 112, 97, 114,
+    101, 110, 116, 95, 105, 100, 10, 66, 69, 71, 73, 78, 10, 32, 32, 32, 32, 68, 69, 76, 69, 84, 69, 10, 32, 32, 32, 32,
+    70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69,
+    32, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 32, 73, 78, 32, 40, 83, 69, 76, 69, 67, 84, 32, 100, 101, 115,
+    99, 101, 110, 100, 97, 110, 116, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101,
+    32, 87, 72, 69, 82, 69, 32, 97, 110, 99, 101, 115, 116, 111, 114, 32, 61, 32, 78, 69, 87, 46, 105, 100, 41, 10, 32,
+    32, 32, 32, 32, 32, 65, 78, 68, 32, 97, 110, 99, 101, 115, 116, 111, 114, 32, 78, 79, 84, 32, 73, 78, 32, 40, 83,
+    69, 76, 69, 67, 84, 32, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107,
+    95, 99, 108, 111, 115, 117, 114, 101, 32, 87, 72, 69, 82, 69, 32, 97, 110, 99, 101, 115, 116, 111, 114, 32, 61, 32,
+    78, 69, 87, 46, 105, 100, 41, 59, 10, 32, 32, 32, 32, 73, 78, 83, 69, 82, 84, 32, 73, 78, 84, 79, 32, 116, 97, 115,
+    107, 95, 99, 108, 111, 115, 117, 114, 101, 40, 97, 110, 99, 101, 115, 116, 111, 114, 44, 32, 100, 101, 115, 99, 101,
+    110, 100, 97, 110, 116, 44, 32, 100, 101, 112, 116, 104, 41, 10, 32, 32, 32, 32, 83, 69, 76, 69, 67, 84, 32, 115,
+    117, 112, 101, 114, 46, 97, 110, 99, 101, 115, 116, 111, 114, 44, 32, 115, 117, 98, 46, 100, 101, 115, 99, 101, 110,
+    100, 97, 110, 116, 44, 32, 115, 117, 112, 101, 114, 46, 100, 101, 112, 116, 104, 32, 43, 32, 115, 117, 98, 46, 100,
+    101, 112, 116, 104, 32, 43, 32, 49, 10, 32, 32, 32, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 99, 108, 111,
+    115, 117, 114, 101, 32, 65, 83, 32, 115, 117, 112, 101, 114, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    67, 82, 79, 83, 83, 32, 74, 79, 73, 78, 32, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 32, 65, 83, 32,
+    115, 117, 98, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 115, 117, 112, 101, 114, 46, 100, 101, 115, 99, 101, 110,
+    100, 97, 110, 116, 32, 61, 32, 78, 69, 87, 46, 112, 97, 114, 101, 110, 116, 95, 105, 100, 10, 32, 32, 32, 32, 32,
+    32, 65, 78, 68, 32, 115, 117, 98, 46, 97, 110, 99, 101, 115, 116, 111, 114, 32, 61, 32, 78, 69, 87, 46, 105, 100,
+    59, 10, 69, 78, 68, 59, 10, 10, 73, 78, 83, 69, 82, 84, 32, 73, 78, 84, 79, 32, 116, 97, 115, 107, 95, 99, 108, 111,
+    115, 117, 114, 101, 40, 97, 110, 99, 101, 115, 116, 111, 114, 44, 32, 100, 101, 115, 99, 101, 110, 100, 97, 110,
+    116, 44, 32, 100, 101, 112, 116, 104, 41, 10, 87, 73, 84, 72, 32, 82, 69, 67, 85, 82, 83, 73, 86, 69, 32, 99, 108,
+    111, 115, 117, 114, 101, 40, 97, 110, 99, 101, 115, 116, 111, 114, 44, 32, 100, 101, 115, 99, 101, 110, 100, 97,
+    110, 116, 44, 32, 100, 101, 112, 116, 104, 41, 32, 65, 83, 32, 40, 83, 69, 76, 69, 67, 84, 32, 105, 100, 44, 32,
+    105, 100, 44, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 105, 100, 32, 61, 32, 63, 49, 10, 32, 32,
+    32, 32, 32, 32, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 85, 78, 73, 79, 78, 32, 65,
-    76, 76, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69,
-    76, 69, 67, 84, 32, 66, 46, 105, 100, 44, 32, 66, 46, 112, 97, 114, 101, 110, 116, 95, 105, 100, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 85, 78, 73, 79, 78, 32, 65, 76, 76, 10, 32, 32, 32, 32, 32,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70, 82, 79, 77, 32, 104, 105, 101,
-    114, 97, 114, 99, 104, 121, 95, 116, 97, 98, 108, 101, 32, 65, 83, 32, 65, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 69, 67, 84, 32,
+    99, 108, 111, 115, 117, 114, 101, 46, 97, 110, 99, 101, 115, 116, 111, 114, 44, 32, 116, 97, 115, 107, 46, 105, 100,
+    44, 32, 99, 108, 111, 115, 117, 114, 101, 46, 100, 101, 112, 116, 104, 32, 43, 32, 49, 10, 32, 32, 32, 32, 32, 32,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 73, 78, 78, 69, 82,
-    32, 74, 79, 73, 78, 32, 116, 97, 115, 107, 32, 65, 83, 32, 66, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70, 82, 79, 77, 32, 99, 108,
+    111, 115, 117, 114, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 66, 46, 112, 97, 114, 101, 110, 116, 95,
-    105, 100, 32, 61, 32, 65, 46, 105, 100, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 83, 69, 76, 69, 67, 84, 32, 105, 100, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 70, 82, 79, 77, 32, 104, 105, 101, 114, 97, 114, 99, 104, 121, 95, 116, 97, 98, 108, 101, 41, 59, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 73, 78, 78, 69, 82, 32, 74, 79, 73, 78, 32, 116, 97, 115,
+    107, 32, 79, 78, 32, 116, 97, 115, 107, 46, 112, 97, 114, 101, 110, 116, 95, 105, 100, 32, 61, 32, 99, 108, 111,
+    115, 117, 114, 101, 46, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 41, 10, 83, 69, 76, 69, 67, 84, 32, 97, 110,
+    99, 101, 115, 116, 111, 114, 44, 32, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 44, 32, 100, 101, 112, 116,
+    104, 10, 70, 82, 79, 77, 32, 99, 108, 111, 115, 117, 114, 101, 59, 10, 10, 73, 78, 83, 69, 82, 84, 32, 73, 78, 84,
+    79, 32, 109, 105, 103, 114, 97, 116, 101, 32, 40, 97, 112, 112, 108, 105, 101, 100, 41, 10, 86, 65, 76, 85, 69, 83,
+    32, 40, 52, 41, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+
+// mig_v5.sql
+const unsigned long long SIZE_MIG_V5_SQL = 4896;
+const char F_MIG_V5_SQL[] = {
+    68, 82, 79, 80, 32, 84, 82, 73, 71, 71, 69, 82, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 116, 114, 105, 103, 103,
+    101, 114, 95, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 95, 116,
+    97, 115, 107, 95, 105, 110, 115, 101, 114, 116, 59, 10, 68, 82, 79, 80, 32, 84, 82, 73, 71, 71, 69, 82, 32, 73, 70,
+    32, 69, 88, 73, 83, 84, 83, 32, 116, 114, 105, 103, 103, 101, 114, 95, 116, 97, 115, 107, 95, 119, 111, 114, 107,
+    116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 95, 116, 97, 115, 107, 95, 100, 101, 108, 101, 116, 101, 59, 10, 68,
+    82, 79, 80, 32, 84, 82, 73, 71, 71, 69, 82, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 116, 114, 105, 103, 103,
+    101, 114, 95, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 95, 116,
+    97, 115, 107, 95, 114, 101, 112, 97, 114, 101, 110, 116, 59, 10, 68, 82, 79, 80, 32, 84, 82, 73, 71, 71, 69, 82, 32,
+    73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 116, 114, 105, 103, 103, 101, 114, 95, 116, 97, 115, 107, 95, 119, 111, 114,
+    107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 95, 105, 110, 115, 101, 114, 116, 59, 10, 68, 82, 79, 80, 32,
+    84, 82, 73, 71, 71, 69, 82, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 116, 114, 105, 103, 103, 101, 114, 95, 116,
+    97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 95, 117, 112, 100, 97, 116,
+    101, 59, 10, 68, 82, 79, 80, 32, 84, 82, 73, 71, 71, 69, 82, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 116, 114,
+    105, 103, 103, 101, 114, 95, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97,
+    108, 95, 100, 101, 108, 101, 116, 101, 59, 10, 68, 82, 79, 80, 32, 86, 73, 69, 87, 32, 73, 70, 32, 69, 88, 73, 83,
+    84, 83, 32, 116, 111, 116, 97, 108, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 103, 114, 111, 117, 112, 95, 98,
+    121, 95, 116, 97, 115, 107, 59, 10, 68, 82, 79, 80, 32, 84, 65, 66, 76, 69, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83,
+    32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 59, 10, 10, 67, 82,
+    69, 65, 84, 69, 32, 84, 65, 66, 76, 69, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116,
+    111, 116, 97, 108, 10, 40, 10, 32, 32, 32, 32, 116, 97, 115, 107, 95, 105, 100, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 73, 78, 84, 69, 71, 69, 82, 32, 80, 82, 73, 77, 65, 82, 89, 32, 75, 69, 89, 32, 82, 69, 70, 69, 82, 69, 78, 67,
+    69, 83, 32, 116, 97, 115, 107, 32, 40, 105, 100, 41, 32, 79, 78, 32, 68, 69, 76, 69, 84, 69, 32, 67, 65, 83, 67, 65,
+    68, 69, 44, 10, 32, 32, 32, 32, 116, 111, 116, 97, 108, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 32, 32, 73,
+    78, 84, 69, 71, 69, 82, 32, 78, 79, 84, 32, 78, 85, 76, 76, 32, 68, 69, 70, 65, 85, 76, 84, 32, 48, 44, 10, 32, 32,
+    32, 32, 115, 117, 98, 116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 73, 78, 84, 69, 71, 69,
+    82, 32, 78, 79, 84, 32, 78, 85, 76, 76, 32, 68, 69, 70, 65, 85, 76, 84, 32, 48, 10, 41, 59, 10, 10, 67, 82, 69, 65,
+    84, 69, 32, 84, 82, 73, 71, 71, 69, 82, 32, 116, 114, 105, 103, 103, 101, 114, 95, 116, 97, 115, 107, 95, 119, 111,
+    114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 95, 116, 97, 115, 107, 95, 105, 110, 115, 101, 114, 116,
+    10, 32, 32, 32, 32, 65, 70, 84, 69, 82, 32, 73, 78, 83, 69, 82, 84, 10, 32, 32, 32, 32, 79, 78, 32, 116, 97, 115,
+    107, 10, 66, 69, 71, 73, 78, 10, 32, 32, 32, 32, 73, 78, 83, 69, 82, 84, 32, 73, 78, 84, 79, 32, 116, 97, 115, 107,
+    95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 40, 116, 97, 115, 107, 95, 105, 100, 41, 10,
+    32, 32, 32, 32, 86, 65, 76, 85, 69, 83, 32, 40, 78, 69, 87, 46, 105, 100, 41, 59, 10, 69, 78, 68, 59, 10, 10, 67,
+    82, 69, 65, 84, 69, 32, 84, 82, 73, 71, 71, 69, 82, 32, 116, 114, 105, 103, 103, 101, 114, 95, 116, 97, 115, 107,
+    95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 95, 116, 97, 115, 107, 95, 100, 101, 108,
+    101, 116, 101, 10, 32, 32, 32, 32, 66, 69, 70, 79, 82, 69, 32, 68, 69, 76, 69, 84, 69, 10, 32, 32, 32, 32, 79, 78,
+    32, 116, 97, 115, 107, 10, 32, 32, 32, 32, 87, 72, 69, 78, 32, 79, 76, 68, 46, 112, 97, 114, 101, 110, 116, 95, 105,
+    100, 32, 73, 83, 32, 78, 85, 76, 76, 32, 79, 82, 32, 69, 88, 73, 83, 84, 83, 32, 40, 83, 69, 76, 69, 67, 84, 32, 49,
+    32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 32, 87, 72, 69, 82, 69, 32, 105, 100, 32, 61, 32, 79, 76, 68, 46, 112,
+    97, 114, 101, 110, 116, 95, 105, 100, 41, 10, 66, 69, 71, 73, 78, 10, 32, 32, 32, 32, 85, 80, 68, 65, 84, 69, 32,
+    116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 10, 32, 32, 32, 32, 83,
+    69, 84, 32, 115, 117, 98, 116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 61, 32, 115, 117, 98,
+    116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 45, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 83, 69, 76, 69, 67, 84, 32, 115, 117, 98,
+    116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 119,
+    111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 32, 87, 72, 69, 82, 69, 32, 116, 97, 115, 107, 95,
+    105, 100, 32, 61, 32, 79, 76, 68, 46, 105, 100, 41, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 116, 97, 115, 107,
+    95, 105, 100, 32, 73, 78, 32, 40, 83, 69, 76, 69, 67, 84, 32, 97, 110, 99, 101, 115, 116, 111, 114, 32, 70, 82, 79,
+    77, 32, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 32, 87, 72, 69, 82, 69, 32, 100, 101, 115, 99, 101,
+    110, 100, 97, 110, 116, 32, 61, 32, 79, 76, 68, 46, 105, 100, 32, 65, 78, 68, 32, 100, 101, 112, 116, 104, 32, 62,
+    32, 48, 41, 59, 10, 69, 78, 68, 59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 84, 82, 73, 71, 71, 69, 82, 32, 116, 114,
+    105, 103, 103, 101, 114, 95, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97,
+    108, 95, 116, 97, 115, 107, 95, 114, 101, 112, 97, 114, 101, 110, 116, 10, 32, 32, 32, 32, 65, 70, 84, 69, 82, 32,
+    85, 80, 68, 65, 84, 69, 32, 79, 70, 32, 112, 97, 114, 101, 110, 116, 95, 105, 100, 10, 32, 32, 32, 32, 79, 78, 32,
+    116, 97, 115, 107, 10, 32, 32, 32, 32, 87, 72, 69, 78, 32, 79, 76, 68, 46, 112, 97, 114, 101, 110, 116, 95, 105,
+    100, 32, 73, 83, 32, 78, 79, 84, 32, 78, 69, 87, 46, 112, 97, 114, 101, 110, 116, 95, 105, 100, 10, 66, 69, 71, 73,
+    78, 10, 32, 32, 32, 32, 85, 80, 68, 65, 84, 69, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101,
+    95, 116, 111, 116, 97, 108, 10, 32, 32, 32, 32, 83, 69, 84, 32, 115, 117, 98, 116, 114, 101, 101, 95, 119, 111, 114,
+    107, 116, 105, 109, 101, 32, 61, 32, 115, 117, 98, 116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101,
+    32, 45, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 40, 83, 69, 76, 69, 67, 84, 32, 115, 117, 98, 116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101,
+    32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108,
+    32, 87, 72, 69, 82, 69, 32, 116, 97, 115, 107, 95, 105, 100, 32, 61, 32, 78, 69, 87, 46, 105, 100, 41, 10, 32, 32,
+    32, 32, 87, 72, 69, 82, 69, 32, 116, 97, 115, 107, 95, 105, 100, 32, 73, 78, 32, 40, 83, 69, 76, 69, 67, 84, 32, 97,
+    110, 99, 101, 115, 116, 111, 114, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101,
+    32, 87, 72, 69, 82, 69, 32, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 32, 61, 32, 79, 76, 68, 46, 112, 97,
+    114, 101, 110, 116, 95, 105, 100, 41, 59, 10, 32, 32, 32, 32, 85, 80, 68, 65, 84, 69, 32, 116, 97, 115, 107, 95,
+    119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 10, 32, 32, 32, 32, 83, 69, 84, 32, 115, 117,
+    98, 116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 61, 32, 115, 117, 98, 116, 114, 101, 101,
+    95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 83, 69, 76, 69, 67, 84, 32, 115, 117, 98, 116, 114, 101, 101,
+    95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116,
+    105, 109, 101, 95, 116, 111, 116, 97, 108, 32, 87, 72, 69, 82, 69, 32, 116, 97, 115, 107, 95, 105, 100, 32, 61, 32,
+    78, 69, 87, 46, 105, 100, 41, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 116, 97, 115, 107, 95, 105, 100, 32, 73,
+    78, 32, 40, 83, 69, 76, 69, 67, 84, 32, 97, 110, 99, 101, 115, 116, 111, 114, 32, 70, 82, 79, 77, 32, 116, 97, 115,
+    107, 95, 99, 108, 111, 115, 117, 114, 101, 32, 87, 72, 69, 82, 69, 32, 100, 101, 115, 99, 101, 110, 100, 97, 110,
+    116, 32, 61, 32, 78, 69, 87, 46, 112, 97, 114, 101, 110, 116, 95, 105, 100, 41, 59, 10, 69, 78, 68, 59, 10, 10, 67,
+    82, 69, 65, 84, 69, 32, 84, 82, 73, 71, 71, 69, 82, 32, 116, 114, 105, 103, 103, 101, 114, 95, 116, 97, 115, 107,
+    95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 95, 105, 110, 115, 101, 114, 116, 10, 32,
+    32, 32, 32, 65, 70, 84, 69, 82, 32, 73, 78, 83, 69, 82, 84, 10, 32, 32, 32, 32, 79, 78, 32, 119, 111, 114, 107, 116,
+    105, 109, 101, 10, 32, 32, 32, 32, 87, 72, 69, 78, 32, 78, 69, 87, 46, 102, 105, 110, 105, 115, 104, 105, 110, 103,
+    95, 116, 105, 109, 101, 32, 73, 83, 32, 78, 79, 84, 32, 78, 85, 76, 76, 10, 66, 69, 71, 73, 78, 10, 32, 32, 32, 32,
+    85, 80, 68, 65, 84, 69, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97,
+    108, 10, 32, 32, 32, 32, 83, 69, 84, 32, 116, 111, 116, 97, 108, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 61,
+    32, 116, 111, 116, 97, 108, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 43, 32, 40, 78, 69, 87, 46, 102, 105,
+    110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 32, 45, 32, 78, 69, 87, 46, 115, 116, 97, 114, 116, 105,
+    110, 103, 95, 116, 105, 109, 101, 41, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 116, 97, 115, 107, 95, 105, 100,
+    32, 61, 32, 78, 69, 87, 46, 116, 97, 115, 107, 95, 105, 100, 59, 10, 32, 32, 32, 32, 85, 80, 68, 65, 84, 69, 32,
+    116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 10, 32, 32, 32, 32, 83,
+    69, 84, 32, 115, 117, 98, 116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 61, 32, 115, 117, 98,
+    116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 43, 32, 40, 78, 69, 87, 46, 102, 105, 110, 105,
+    115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 32, 45, 32, 78, 69, 87, 46, 115, 116, 97, 114, 116, 105, 110, 103,
+    95, 116, 105, 109, 101, 41, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 116, 97, 115, 107, 95, 105, 100, 32, 73, 78,
+    32, 40, 83, 69, 76, 69, 67, 84, 32, 97, 110, 99, 101, 115, 116, 111, 114, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107,
+    95, 99, 108, 111, 115, 117, 114, 101, 32, 87, 72, 69, 82, 69, 32, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116,
+    32, 61, 32, 78, 69, 87, 46, 116, 97, 115, 107, 95, 105, 100, 41, 59, 10, 69, 78, 68, 59, 10, 10, 67, 82, 69, 65, 84,
+    69, 32, 84, 82, 73, 71, 71, 69, 82, 32, 116, 114, 105, 103, 103, 101, 114, 95, 116, 97, 115, 107, 95, 119, 111, 114,
+    107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 95, 117, 112, 100, 97, 116, 101, 10, 32, 32, 32, 32, 65, 70,
+    84, 69, 82, 32, 85, 80, 68, 65, 84, 69, 32, 79, 70, 32, 116, 97, 115, 107, 95, 105, 100, 44, 32, 115, 116, 97, 114,
+    116, 105, 110, 103, 95, 116, 105, 109, 101, 44, 32, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109,
+    101, 10, 32, 32, 32, 32, 79, 78, 32, 119, 111, 114, 107, 116, 105, 109, 101, 10, 66, 69, 71, 73, 78, 10, 32, 32, 32,
+    32, 85, 80, 68, 65, 84, 69, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116,
+    97, 108, 10, 32, 32, 32, 32, 83, 69, 84, 32, 116, 111, 116, 97, 108, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32,
+    61, 32, 116, 111, 116, 97, 108, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 45, 32, 67, 79, 65, 76, 69, 83, 67,
+    69, 40, 79, 76, 68, 46, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 32, 45, 32, 79, 76, 68,
+    46, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 44, 32, 48, 41, 10, 32, 32, 32, 32, 87, 72, 69,
+    82, 69, 32, 116, 97, 115, 107, 95, 105, 100, 32, 61, 32, 79, 76, 68, 46, 116, 97, 115, 107, 95, 105, 100, 59, 10,
+    32, 32, 32, 32, 85, 80, 68, 65, 84, 69, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116,
+    111, 116, 97, 108, 10, 32, 32, 32, 32, 83, 69, 84, 32, 115, 117, 98, 116, 114, 101, 101, 95, 119, 111, 114, 107,
+    116, 105, 109, 101, 32, 61, 32, 115, 117, 98, 116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32,
+    45, 32, 67, 79, 65, 76, 69, 83, 67, 69, 40, 79, 76, 68, 46, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116,
+    105, 109, 101, 32, 45, 32, 79, 76, 68, 46, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 44, 32,
+    48, 41, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 116, 97, 115, 107, 95, 105, 100, 32, 73, 78, 32, 40, 83, 69, 76,
+    69, 67, 84, 32, 97, 110, 99, 101, 115, 116, 111, 114, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 99, 108, 111,
+    115, 117, 114, 101, 32, 87, 72, 69, 82, 69, 32, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 32, 61, 32, 79, 76,
+    68, 46, 116, 97, 115, 107, 95, 105, 100, 41, 59, 10, 32, 32, 32, 32, 85, 80, 68, 65, 84, 69, 32, 116, 97, 115, 107,
+    95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 10, 32, 32, 32, 32, 83, 69, 84, 32, 116,
+    111, 116, 97, 108, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 61, 32, 116, 111, 116, 97, 108, 95, 119, 111,
+    114, 107, 116, 105, 109, 101, 32, 43, 32, 67, 79, 65, 76, 69, 83, 67, 69, 40, 78, 69, 87, 46, 102, 105, 110, 105,
+    115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 32, 45, 32, 78, 69, 87, 46, 115, 116, 97, 114, 116, 105, 110, 103,
+    95, 116, 105, 109, 101, 44, 32, 48, 41, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 116, 97, 115, 107, 95, 105, 100,
+    32, 61, 32, 78, 69, 87, 46, 116, 97, 115, 107, 95, 105, 100, 59, 10, 32, 32, 32, 32, 85, 80, 68, 65, 84, 69, 32,
+    116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 10, 32, 32, 32, 32, 83,
+    69, 84, 32, 115, 117, 98, 116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 61, 32, 115, 117, 98,
+    116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 43, 32, 67, 79, 65, 76, 69, 83, 67, 69, 40, 78,
+    69, 87, 46, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 32, 45, 32, 78, 69, 87, 46, 115,
+    116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 44, 32, 48, 41, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69,
+    32, 116, 97, 115, 107, 95, 105, 100, 32, 73, 78, 32, 40, 83, 69, 76, 69, 67, 84, 32, 97, 110, 99, 101, 115, 116,
+    111, 114, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 32, 87, 72, 69, 82, 69,
+    32, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 32, 61, 32, 78, 69, 87, 46, 116, 97, 115, 107, 95, 105, 100, 41,
+    59, 10, 69, 78, 68, 59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 84, 82, 73, 71, 71, 69, 82, 32, 116, 114, 105, 103, 103,
+    101, 114, 95, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 95, 100,
+    101, 108, 101, 116, 101, 10, 32, 32, 32, 32, 65, 70, 84, 69, 82, 32, 68, 69, 76, 69, 84, 69, 10, 32, 32, 32, 32, 79,
+    78, 32, 119, 111, 114, 107, 116, 105, 109, 101, 10, 32, 32, 32, 32, 87, 72, 69, 78, 32, 79, 76, 68, 46, 102, 105,
+    110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 32, 73, 83, 32, 78, 79, 84, 32, 78, 85, 76, 76, 32, 65,
+    78, 68, 32, 69, 88, 73, 83, 84, 83, 32, 40, 83, 69, 76, 69, 67, 84, 32, 49, 32, 70, 82, 79, 77, 32, 116, 97, 115,
+    107, 32, 87, 72, 69, 82, 69, 32, 105, 100, 32, 61, 32, 79, 76, 68, 46, 116, 97, 115, 107, 95, 105, 100, 41, 10, 66,
+    69, 71, 73, 78, 10, 32, 32, 32, 32, 85, 80, 68, 65, 84, 69, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105,
+    109, 101, 95, 116, 111, 116, 97, 108, 10, 32, 32, 32, 32, 83, 69, 84, 32, 116, 111, 116, 97, 108, 95, 119, 111, 114,
+    107, 116, 105, 109, 101, 32, 61, 32, 116, 111, 116, 97, 108, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 45, 32,
+    40, 79, 76, 68, 46, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 32, 45, 32, 79, 76, 68, 46,
+    115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 41, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 116,
+    97, 115, 107, 95, 105, 100, 32, 61, 32, 79, 76, 68, 46, 116, 97, 115, 107, 95, 105, 100, 59, 10, 32, 32, 32, 32, 85,
+    80, 68, 65, 84, 69, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108,
+    10, 32, 32, 32, 32, 83, 69, 84, 32, 115, 117, 98, 116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101,
+    32, 61, 32, 115, 117, 98, 116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 45, 32, 40, 79, 76,
+    68, 46, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 32, 45, 32, 79, 76, 68, 46, 115, 116,
+    97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 41, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 116, 97, 115,
+    107, 95, 105, 100, 32, 73, 78, 32, 40, 83, 69, 76, 69, 67, 84, 32, 97, 110, 99, 101, 115, 116, 111, 114, 32, 70, 82,
+    79, 77, 32, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 32, 87, 72, 69, 82, 69, 32, 100, 101, 115, 99,
+    101, 110, 100, 97, 110, 116, 32, 61, 32, 79, 76, 68, 46, 116, 97, 115, 107, 95, 105, 100, 41, 59, 10, 69, 78, 68,
+    59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 86, 73, 69, 87, 32, 116, 111, 116, 97, 108, 95, 119, 111, 114, 107, 116,
+    105, 109, 101, 95, 103, 114, 111, 117, 112, 95, 98, 121, 95, 116, 97, 115, 107, 32, 65, 83, 10, 83, 69, 76, 69, 67,
+    84, 32, 116, 97, 115, 107, 46, 112, 97, 114, 101, 110, 116, 95, 105, 100, 32, 112, 97, 114, 101, 110, 116, 95, 116,
+    97, 115, 107, 44, 10, 32, 32, 32, 32, 32, 32, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95,
+    116, 111, 116, 97, 108, 46, 116, 97, 115, 107, 95, 105, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 116, 97, 115, 107,
+    95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 46, 116, 111, 116, 97, 108, 95, 119, 111,
+    114, 107, 116, 105, 109, 101, 10, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101,
+    95, 116, 111, 116, 97, 108, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 73, 78, 78, 69, 82, 32, 74, 79, 73, 78, 32, 116,
+    97, 115, 107, 32, 79, 78, 32, 116, 97, 115, 107, 46, 105, 100, 32, 61, 32, 116, 97, 115, 107, 95, 119, 111, 114,
+    107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 46, 116, 97, 115, 107, 95, 105, 100, 59, 10, 10, 73, 78, 83,
+    69, 82, 84, 32, 73, 78, 84, 79, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111,
+    116, 97, 108, 40, 116, 97, 115, 107, 95, 105, 100, 44, 32, 116, 111, 116, 97, 108, 95, 119, 111, 114, 107, 116, 105,
+    109, 101, 41, 10, 83, 69, 76, 69, 67, 84, 32, 116, 97, 115, 107, 46, 105, 100, 44, 32, 67, 79, 65, 76, 69, 83, 67,
+    69, 40, 83, 85, 77, 40, 119, 111, 114, 107, 116, 105, 109, 101, 46, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95,
+    116, 105, 109, 101, 32, 45, 32, 119, 111, 114, 107, 116, 105, 109, 101, 46, 115, 116, 97, 114, 116, 105, 110, 103,
+    95, 116, 105, 109, 101, 41, 44, 32, 48, 41, 10, 70, 82, 79, 77, 32, 116, 97, 115, 107, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 76, 69, 70, 84, 32, 79, 85, 84, 69, 82, 32, 74, 79, 73, 78, 32, 119, 111, 114, 107, 116, 105, 109, 101,
+    32, 79, 78, 32, 119, 111, 114, 107, 116, 105, 109, 101, 46, 116, 97, 115, 107, 95, 105, 100, 32, 61, 32, 116, 97,
+    115, 107, 46, 105, 100, 10, 71, 82, 79, 85, 80, 32, 66, 89, 32, 116, 97, 115, 107, 46, 105, 100, 59, 10, 10, 85, 80,
+    68, 65, 84, 69, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 10,
+    83, 69, 84, 32, 115, 117, 98, 116, 114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 32, 61, 32, 40, 83,
+    69, 76, 69, 67, 84, 32, 67, 79, 65, 76, 69, 83, 67, 69, 40, 83, 85, 77, 40, 116, 111, 116, 97, 108, 46, 116, 111,
+    116, 97, 108, 95, 119, 111, 114, 107, 116, 105, 109, 101, 41, 44, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 99, 108,
+    111, 115, 117, 114, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 73, 78, 78, 69, 82, 32, 74, 79, 73, 78, 32, 116, 97, 115, 107, 95, 119,
+    111, 114, 107, 116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 32, 65, 83, 32, 116, 111, 116, 97, 108, 32, 79, 78,
+    32, 116, 111, 116, 97, 108, 46, 116, 97, 115, 107, 95, 105, 100, 32, 61, 32, 116, 97, 115, 107, 95, 99, 108, 111,
+    115, 117, 114, 101, 46, 100, 101, 115, 99, 101, 110, 100, 97, 110, 116, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 116, 97, 115, 107, 95, 99, 108, 111,
+    115, 117, 114, 101, 46, 97, 110, 99, 101, 115, 116, 111, 114, 32, 61, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107,
+    116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 46, 116, 97, 115, 107, 95, 105, 100, 41, 59, 10, 10, 73, 78, 83, 69,
+    82, 84, 32, 73, 78, 84, 79, 32, 109, 105, 103, 114, 97, 116, 101, 32, 40, 97, 112, 112, 108, 105, 101, 100, 41, 10,
+    86, 65, 76, 85, 69, 83, 32, 40, 53, 41, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+
+// mig_v6.sql
+const unsigned long long SIZE_MIG_V6_SQL = 1190;
+const char F_MIG_V6_SQL[] = {
+    68, 82, 79, 80, 32, 84, 82, 73, 71, 71, 69, 82, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 116, 114, 105, 103, 103,
+    101, 114, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 114, 116, 114, 101, 101, 95, 105, 110, 115, 101, 114, 116,
+    59, 10, 68, 82, 79, 80, 32, 84, 82, 73, 71, 71, 69, 82, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 116, 114, 105,
+    103, 103, 101, 114, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 114, 116, 114, 101, 101, 95, 117, 112, 100, 97,
+    116, 101, 59, 10, 68, 82, 79, 80, 32, 84, 82, 73, 71, 71, 69, 82, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 116,
+    114, 105, 103, 103, 101, 114, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 114, 116, 114, 101, 101, 95, 100, 101,
+    108, 101, 116, 101, 59, 10, 68, 82, 79, 80, 32, 84, 65, 66, 76, 69, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 119,
+    111, 114, 107, 116, 105, 109, 101, 95, 114, 116, 114, 101, 101, 59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 86, 73, 82,
+    84, 85, 65, 76, 32, 84, 65, 66, 76, 69, 32, 119, 111, 114, 107, 116, 105, 109, 101, 95, 114, 116, 114, 101, 101, 32,
+    85, 83, 73, 78, 71, 32, 114, 116, 114, 101, 101, 10, 40, 10, 32, 32, 32, 32, 105, 100, 44, 10, 32, 32, 32, 32, 115,
+    116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 44, 10, 32, 32, 32, 32, 102, 105, 110, 105, 115, 104, 105,
+    110, 103, 95, 116, 105, 109, 101, 10, 41, 59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 84, 82, 73, 71, 71, 69, 82, 32,
+    116, 114, 105, 103, 103, 101, 114, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 114, 116, 114, 101, 101, 95, 105,
+    110, 115, 101, 114, 116, 10, 32, 32, 32, 32, 65, 70, 84, 69, 82, 32, 73, 78, 83, 69, 82, 84, 10, 32, 32, 32, 32, 79,
+    78, 32, 119, 111, 114, 107, 116, 105, 109, 101, 10, 66, 69, 71, 73, 78, 10, 32, 32, 32, 32, 73, 78, 83, 69, 82, 84,
+    32, 73, 78, 84, 79, 32, 119, 111, 114, 107, 116, 105, 109, 101, 95, 114, 116, 114, 101, 101, 40, 105, 100, 44, 32,
+    115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 44, 32, 102, 105, 110, 105, 115, 104, 105, 110, 103,
+    95, 116, 105, 109, 101, 41, 10, 32, 32, 32, 32, 86, 65, 76, 85, 69, 83, 32, 40, 78, 69, 87, 46, 105, 100, 44, 32,
+    78, 69, 87, 46, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 44, 32, 67, 79, 65, 76, 69, 83, 67,
+    69, 40, 78, 69, 87, 46, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 44, 32, 50, 53, 51, 52,
+    48, 50, 51, 48, 48, 55, 57, 57, 41, 41, 59, 10, 69, 78, 68, 59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 84, 82, 73, 71,
+    71, 69, 82, 32, 116, 114, 105, 103, 103, 101, 114, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 114, 116, 114,
+    101, 101, 95, 117, 112, 100, 97, 116, 101, 10, 32, 32, 32, 32, 65, 70, 84, 69, 82, 32, 85, 80, 68, 65, 84, 69, 32,
+    79, 70, 32, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 44, 32, 102, 105, 110, 105, 115, 104,
+    105, 110, 103, 95, 116, 105, 109, 101, 10, 32, 32, 32, 32, 79, 78, 32, 119, 111, 114, 107, 116, 105, 109, 101, 10,
+    66, 69, 71, 73, 78, 10, 32, 32, 32, 32, 85, 80, 68, 65, 84, 69, 32, 119, 111, 114, 107, 116, 105, 109, 101, 95, 114,
+    116, 114, 101, 101, 10, 32, 32, 32, 32, 83, 69, 84, 32, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109,
+    101, 32, 32, 61, 32, 78, 69, 87, 46, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 32, 61, 32, 67, 79, 65,
+    76, 69, 83, 67, 69, 40, 78, 69, 87, 46, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 44, 32,
+    50, 53, 51, 52, 48, 50, 51, 48, 48, 55, 57, 57, 41, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 105, 100, 32, 61,
+    32, 78, 69, 87, 46, 105, 100, 59, 10, 69, 78, 68, 59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 84, 82, 73, 71, 71, 69,
+    82, 32, 116, 114, 105, 103, 103, 101, 114, 95, 119, 111, 114, 107, 116, 105, 109, 101, 95, 114, 116, 114, 101, 101,
+    95, 100, 101, 108, 101, 116, 101, 10, 32, 32, 32, 32, 65, 70, 84, 69, 82, 32, 68, 69, 76, 69, 84, 69, 10, 32, 32,
+    32, 32, 79, 78, 32, 119, 111, 114, 107, 116, 105, 109, 101, 10, 66, 69, 71, 73, 78, 10, 32, 32, 32, 32, 68, 69, 76,
+    69, 84, 69, 32, 70, 82, 79, 77, 32, 119, 111, 114, 107, 116, 105, 109, 101, 95, 114, 116, 114, 101, 101, 32, 87, 72,
+    69, 82, 69, 32, 105, 100, 32, 61, 32, 79, 76, 68, 46, 105, 100, 59, 10, 69, 78, 68, 59, 10, 10, 73, 78, 83, 69, 82,
+    84, 32, 73, 78, 84, 79, 32, 119, 111, 114, 107, 116, 105, 109, 101, 95, 114, 116, 114, 101, 101, 40, 105, 100, 44,
+    32, 115, 116, 97, 114, 116, 105, 110, 103, 95, 116, 105, 109, 101, 44, 32, 102, 105, 110, 105, 115, 104, 105, 110,
+    103, 95, 116, 105, 109, 101, 41, 10, 83, 69, 76, 69, 67, 84, 32, 105, 100, 44, 32, 115, 116, 97, 114, 116, 105, 110,
+    103, 95, 116, 105, 109, 101, 44, 32, 67, 79, 65, 76, 69, 83, 67, 69, 40, 102, 105, 110, 105, 115, 104, 105, 110,
+    103, 95, 116, 105, 109, 101, 44, 32, 50, 53, 51, 52, 48, 50, 51, 48, 48, 55, 57, 57, 41, 10, 70, 82, 79, 77, 32,
+    119, 111, 114, 107, 116, 105, 109, 101, 59, 10, 10, 73, 78, 83, 69, 82, 84, 32, 73, 78, 84, 79, 32, 109, 105, 103,
+    114, 97, 116, 101, 32, 40, 97, 112, 112, 108, 105, 101, 100, 41, 10, 86, 65, 76, 85, 69, 83, 32, 40, 54, 41, 59, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0
+};
+
+
+// mig_v7.sql
+const unsigned long long SIZE_MIG_V7_SQL = 210;
+const char F_MIG_V7_SQL[] = {
+    68, 82, 79, 80, 32, 73, 78, 68, 69, 88, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 105, 100, 120, 95, 119, 111,
+    114, 107, 116, 105, 109, 101, 95, 97, 99, 116, 105, 118, 101, 59, 10, 68, 82, 79, 80, 32, 86, 73, 69, 87, 32, 73,
+    70, 32, 69, 88, 73, 83, 84, 83, 32, 110, 117, 108, 108, 95, 115, 101, 116, 95, 119, 111, 114, 107, 116, 105, 109,
+    101, 59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 73, 78, 68, 69, 88, 32, 105, 100, 120, 95, 119, 111, 114, 107, 116,
+    105, 109, 101, 95, 97, 99, 116, 105, 118, 101, 32, 79, 78, 32, 119, 111, 114, 107, 116, 105, 109, 101, 32, 40, 105,
+    100, 41, 32, 87, 72, 69, 82, 69, 32, 102, 105, 110, 105, 115, 104, 105, 110, 103, 95, 116, 105, 109, 101, 32, 73,
+    83, 32, 78, 85, 76, 76, 59, 10, 10, 73, 78, 83, 69, 82, 84, 32, 73, 78, 84, 79, 32, 109, 105, 103, 114, 97, 116,
+    101, 32, 40, 97, 112, 112, 108, 105, 101, 100, 41, 10, 86, 65, 76, 85, 69, 83, 32, 40, 55, 41, 59, 0, 0, 0, 0, 0, 0
+};
+
+
+// mig_v8.sql
+const unsigned long long SIZE_MIG_V8_SQL = 2246;
+const char F_MIG_V8_SQL[] = {
+    68, 82, 79, 80, 32, 84, 82, 73, 71, 71, 69, 82, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 116, 114, 105, 103, 103,
+    101, 114, 95, 116, 97, 115, 107, 95, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 95, 105, 110, 115, 101,
+    114, 116, 59, 10, 68, 82, 79, 80, 32, 84, 82, 73, 71, 71, 69, 82, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 116,
+    114, 105, 103, 103, 101, 114, 95, 116, 97, 115, 107, 95, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 95,
+    100, 101, 108, 101, 116, 101, 59, 10, 68, 82, 79, 80, 32, 84, 82, 73, 71, 71, 69, 82, 32, 73, 70, 32, 69, 88, 73,
+    83, 84, 83, 32, 116, 114, 105, 103, 103, 101, 114, 95, 116, 97, 115, 107, 95, 99, 104, 105, 108, 100, 95, 99, 111,
+    117, 110, 116, 95, 117, 112, 100, 97, 116, 101, 59, 10, 68, 82, 79, 80, 32, 84, 65, 66, 76, 69, 32, 73, 70, 32, 69,
+    88, 73, 83, 84, 83, 32, 116, 97, 115, 107, 95, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 59, 10, 68, 82,
+    79, 80, 32, 73, 78, 68, 69, 88, 32, 73, 70, 32, 69, 88, 73, 83, 84, 83, 32, 105, 100, 120, 95, 116, 97, 115, 107,
+    95, 99, 104, 105, 108, 100, 114, 101, 110, 59, 10, 68, 82, 79, 80, 32, 73, 78, 68, 69, 88, 32, 73, 70, 32, 69, 88,
+    73, 83, 84, 83, 32, 105, 100, 120, 95, 116, 97, 115, 107, 95, 115, 116, 97, 116, 117, 115, 95, 105, 100, 95, 112,
+    101, 114, 95, 112, 97, 114, 101, 110, 116, 59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 73, 78, 68, 69, 88, 32, 105, 100,
+    120, 95, 116, 97, 115, 107, 95, 99, 104, 105, 108, 100, 114, 101, 110, 32, 79, 78, 32, 116, 97, 115, 107, 32, 40,
+    112, 97, 114, 101, 110, 116, 95, 105, 100, 44, 32, 115, 116, 97, 116, 117, 115, 95, 105, 100, 44, 32, 110, 97, 109,
+    101, 44, 32, 105, 100, 41, 59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 84, 65, 66, 76, 69, 32, 116, 97, 115, 107, 95,
+    99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 10, 40, 10, 32, 32, 32, 32, 112, 97, 114, 101, 110, 116, 95,
+    105, 100, 32, 32, 32, 73, 78, 84, 69, 71, 69, 82, 32, 78, 79, 84, 32, 78, 85, 76, 76, 44, 10, 32, 32, 32, 32, 115,
+    116, 97, 116, 117, 115, 95, 105, 100, 32, 32, 32, 73, 78, 84, 69, 71, 69, 82, 32, 78, 79, 84, 32, 78, 85, 76, 76,
+    44, 10, 32, 32, 32, 32, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 32, 73, 78, 84, 69, 71, 69, 82, 32, 78,
+    79, 84, 32, 78, 85, 76, 76, 32, 68, 69, 70, 65, 85, 76, 84, 32, 48, 44, 10, 32, 32, 32, 32, 80, 82, 73, 77, 65, 82,
+    89, 32, 75, 69, 89, 32, 40, 112, 97, 114, 101, 110, 116, 95, 105, 100, 44, 32, 115, 116, 97, 116, 117, 115, 95, 105,
+    100, 41, 10, 41, 32, 87, 73, 84, 72, 79, 85, 84, 32, 82, 79, 87, 73, 68, 59, 10, 10, 67, 82, 69, 65, 84, 69, 32, 84,
+    82, 73, 71, 71, 69, 82, 32, 116, 114, 105, 103, 103, 101, 114, 95, 116, 97, 115, 107, 95, 99, 104, 105, 108, 100,
+    95, 99, 111, 117, 110, 116, 95, 105, 110, 115, 101, 114, 116, 10, 32, 32, 32, 32, 65, 70, 84, 69, 82, 32, 73, 78,
+    83, 69, 82, 84, 10, 32, 32, 32, 32, 79, 78, 32, 116, 97, 115, 107, 10, 66, 69, 71, 73, 78, 10, 32, 32, 32, 32, 73,
+    78, 83, 69, 82, 84, 32, 73, 78, 84, 79, 32, 116, 97, 115, 107, 95, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110,
+    116, 40, 112, 97, 114, 101, 110, 116, 95, 105, 100, 44, 32, 115, 116, 97, 116, 117, 115, 95, 105, 100, 44, 32, 99,
+    104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 41, 10, 32, 32, 32, 32, 86, 65, 76, 85, 69, 83, 32, 40, 99, 111, 97,
+    108, 101, 115, 99, 101, 40, 78, 69, 87, 46, 112, 97, 114, 101, 110, 116, 95, 105, 100, 44, 32, 48, 41, 44, 32, 78,
+    69, 87, 46, 115, 116, 97, 116, 117, 115, 95, 105, 100, 44, 32, 49, 41, 10, 32, 32, 32, 32, 79, 78, 32, 67, 79, 78,
+    70, 76, 73, 67, 84, 32, 40, 112, 97, 114, 101, 110, 116, 95, 105, 100, 44, 32, 115, 116, 97, 116, 117, 115, 95, 105,
+    100, 41, 32, 68, 79, 32, 85, 80, 68, 65, 84, 69, 32, 83, 69, 84, 32, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110,
+    116, 32, 61, 32, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 32, 43, 32, 49, 59, 10, 69, 78, 68, 59, 10, 10,
+    67, 82, 69, 65, 84, 69, 32, 84, 82, 73, 71, 71, 69, 82, 32, 116, 114, 105, 103, 103, 101, 114, 95, 116, 97, 115,
+    107, 95, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 95, 100, 101, 108, 101, 116, 101, 10, 32, 32, 32, 32,
+    65, 70, 84, 69, 82, 32, 68, 69, 76, 69, 84, 69, 10, 32, 32, 32, 32, 79, 78, 32, 116, 97, 115, 107, 10, 66, 69, 71,
+    73, 78, 10, 32, 32, 32, 32, 85, 80, 68, 65, 84, 69, 32, 116, 97, 115, 107, 95, 99, 104, 105, 108, 100, 95, 99, 111,
+    117, 110, 116, 10, 32, 32, 32, 32, 83, 69, 84, 32, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 32, 61, 32,
+    99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 32, 45, 32, 49, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 112,
+    97, 114, 101, 110, 116, 95, 105, 100, 32, 61, 32, 99, 111, 97, 108, 101, 115, 99, 101, 40, 79, 76, 68, 46, 112, 97,
+    114, 101, 110, 116, 95, 105, 100, 44, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 65, 78, 68, 32, 115, 116, 97, 116,
+    117, 115, 95, 105, 100, 32, 61, 32, 79, 76, 68, 46, 115, 116, 97, 116, 117, 115, 95, 105, 100, 59, 10, 32, 32, 32,
+    32, 68, 69, 76, 69, 84, 69, 10, 32, 32, 32, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 99, 104, 105, 108, 100,
+    95, 99, 111, 117, 110, 116, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 112, 97, 114, 101, 110, 116, 95, 105, 100,
+    32, 61, 32, 99, 111, 97, 108, 101, 115, 99, 101, 40, 79, 76, 68, 46, 112, 97, 114, 101, 110, 116, 95, 105, 100, 44,
+    32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 65, 78, 68, 32, 115, 116, 97, 116, 117, 115, 95, 105, 100, 32, 61, 32, 79,
+    76, 68, 46, 115, 116, 97, 116, 117, 115, 95, 105, 100, 10, 32, 32, 32, 32, 32, 32, 65, 78, 68, 32, 99, 104, 105,
+    108, 100, 95, 99, 111, 117, 110, 116, 32, 60, 61, 32, 48, 59, 10, 69, 78, 68, 59, 10, 10, 67, 82, 69, 65, 84, 69,
+    32, 84, 82, 73, 71, 71, 69, 82, 32, 116, 114, 105, 103, 103, 101, 114, 95, 116, 97, 115, 107, 95, 99, 104, 105, 108,
+    100, 95, 99, 111, 117, 110, 116, 95, 117, 112, 100, 97, 116, 101, 10, 32, 32, 32, 32, 65, 70, 84, 69, 82, 32, 85,
+    80, 68, 65, 84, 69, 32, 79, 70, 32, 112, 97, 114, 101, 110, 116, 95, 105, 100, 44, 32, 115, 116, 97, 116, 117, 115,
+    95, 105, 100, 10, 32, 32, 32, 32, 79, 78, 32, 116, 97, 115, 107, 10, 32, 32, 32, 32, 87, 72, 69, 78, 32, 79, 76, 68,
+    46, 112, 97, 114, 101, 110, 116, 95, 105, 100, 32, 73, 83, 32, 78, 79, 84, 32, 78, 69, 87, 46, 112, 97, 114, 101,
+    110, 116, 95, 105, 100, 32, 79, 82, 32, 79, 76, 68, 46, 115, 116, 97, 116, 117, 115, 95, 105, 100, 32, 73, 83, 32,
+    78, 79, 84, 32, 78, 69, 87, 46, 115, 116, 97, 116, 117, 115, 95, 105, 100, 10, 66, 69, 71, 73, 78, 10, 32, 32, 32,
+    32, 85, 80, 68, 65, 84, 69, 32, 116, 97, 115, 107, 95, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 10, 32,
+    32, 32, 32, 83, 69, 84, 32, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 32, 61, 32, 99, 104, 105, 108, 100,
+    95, 99, 111, 117, 110, 116, 32, 45, 32, 49, 10, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 112, 97, 114, 101, 110, 116,
+    95, 105, 100, 32, 61, 32, 99, 111, 97, 108, 101, 115, 99, 101, 40, 79, 76, 68, 46, 112, 97, 114, 101, 110, 116, 95,
+    105, 100, 44, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 65, 78, 68, 32, 115, 116, 97, 116, 117, 115, 95, 105, 100, 32,
+    61, 32, 79, 76, 68, 46, 115, 116, 97, 116, 117, 115, 95, 105, 100, 59, 10, 32, 32, 32, 32, 68, 69, 76, 69, 84, 69,
+    10, 32, 32, 32, 32, 70, 82, 79, 77, 32, 116, 97, 115, 107, 95, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116,
+    10, 32, 32, 32, 32, 87, 72, 69, 82, 69, 32, 112, 97, 114, 101, 110, 116, 95, 105, 100, 32, 61, 32, 99, 111, 97, 108,
+    101, 115, 99, 101, 40, 79, 76, 68, 46, 112, 97, 114, 101, 110, 116, 95, 105, 100, 44, 32, 48, 41, 10, 32, 32, 32,
+    32, 32, 32, 65, 78, 68, 32, 115, 116, 97, 116, 117, 115, 95, 105, 100, 32, 61, 32, 79, 76, 68, 46, 115, 116, 97,
+    116, 117, 115, 95, 105, 100, 10, 32, 32, 32, 32, 32, 32, 65, 78, 68, 32, 99, 104, 105, 108, 100, 95, 99, 111, 117,
+    110, 116, 32, 60, 61, 32, 48, 59, 10, 32, 32, 32, 32, 73, 78, 83, 69, 82, 84, 32, 73, 78, 84, 79, 32, 116, 97, 115,
+    107, 95, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 40, 112, 97, 114, 101, 110, 116, 95, 105, 100, 44, 32,
+    115, 116, 97, 116, 117, 115, 95, 105, 100, 44, 32, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 41, 10, 32,
+    32, 32, 32, 86, 65, 76, 85, 69, 83, 32, 40, 99, 111, 97, 108, 101, 115, 99, 101, 40, 78, 69, 87, 46, 112, 97, 114,
+    101, 110, 116, 95, 105, 100, 44, 32, 48, 41, 44, 32, 78, 69, 87, 46, 115, 116, 97, 116, 117, 115, 95, 105, 100, 44,
+    32, 49, 41, 10, 32, 32, 32, 32, 79, 78, 32, 67, 79, 78, 70, 76, 73, 67, 84, 32, 40, 112, 97, 114, 101, 110, 116, 95,
+    105, 100, 44, 32, 115, 116, 97, 116, 117, 115, 95, 105, 100, 41, 32, 68, 79, 32, 85, 80, 68, 65, 84, 69, 32, 83, 69,
+    84, 32, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 32, 61, 32, 99, 104, 105, 108, 100, 95, 99, 111, 117,
+    110, 116, 32, 43, 32, 49, 59, 10, 69, 78, 68, 59, 10, 10, 73, 78, 83, 69, 82, 84, 32, 73, 78, 84, 79, 32, 116, 97,
+    115, 107, 95, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 40, 112, 97, 114, 101, 110, 116, 95, 105, 100, 44,
+    32, 115, 116, 97, 116, 117, 115, 95, 105, 100, 44, 32, 99, 104, 105, 108, 100, 95, 99, 111, 117, 110, 116, 41, 10,
+    83, 69, 76, 69, 67, 84, 32, 99, 111, 97, 108, 101, 115, 99, 101, 40, 112, 97, 114, 101, 110, 116, 95, 105, 100, 44,
+    32, 48, 41, 44, 32, 115, 116, 97, 116, 117, 115, 95, 105, 100, 44, 32, 67, 79, 85, 78, 84, 40, 42, 41, 10, 70, 82,
+    79, 77, 32, 116, 97, 115, 107, 10, 71, 82, 79, 85, 80, 32, 66, 89, 32, 99, 111, 97, 108, 101, 115, 99, 101, 40, 112,
+    97, 114, 101, 110, 116, 95, 105, 100, 44, 32, 48, 41, 44, 32, 115, 116, 97, 116, 117, 115, 95, 105, 100, 59, 10, 10,
+    73, 78, 83, 69, 82, 84, 32, 73, 78, 84, 79, 32, 109, 105, 103, 114, 97, 116, 101, 32, 40, 97, 112, 112, 108, 105,
+    101, 100, 41, 10, 86, 65, 76, 85, 69, 83, 32, 40, 56, 41, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+
+// task_detail_snapshot.sql
+const unsigned long long SIZE_TASK_DETAIL_SNAPSHOT_SQL = 557;
+const char F_TASK_DETAIL_SNAPSHOT_SQL[] = {
+    83, 69, 76, 69, 67, 84, 32, 116, 97, 115, 107, 46, 105, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 116, 97, 115, 107,
+    46, 112, 97, 114, 101, 110, 116, 95, 105, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 116, 97, 115, 107, 46, 110, 97,
+    109, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 116, 97, 115, 107, 46, 100, 101, 116, 97, 105, 108, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 116, 97, 115, 107, 46, 115, 116, 97, 116, 117, 115, 95, 105, 100, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 116, 97, 115, 107, 46, 99, 114, 101, 97, 116, 101, 100, 95, 97, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    116, 97, 115, 107, 46, 117, 112, 100, 97, 116, 101, 100, 95, 97, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 67, 79,
+    65, 76, 69, 83, 67, 69, 40, 116, 111, 116, 97, 108, 46, 116, 111, 116, 97, 108, 95, 119, 111, 114, 107, 116, 105,
+    109, 101, 44, 32, 48, 41, 32, 32, 32, 65, 83, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107, 116, 105, 109, 101, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 67, 79, 65, 76, 69, 83, 67, 69, 40, 116, 111, 116, 97, 108, 46, 115, 117, 98, 116,
+    114, 101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 44, 32, 48, 41, 32, 65, 83, 32, 115, 117, 98, 116, 114,
+    101, 101, 95, 119, 111, 114, 107, 116, 105, 109, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 69, 88, 73, 83, 84, 83,
+    32, 40, 83, 69, 76, 69, 67, 84, 32, 49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70, 82, 79,
+    77, 32, 116, 97, 115, 107, 95, 99, 108, 111, 115, 117, 114, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 87, 72, 69, 82, 69, 32, 97, 110, 99, 101, 115, 116, 111, 114, 32, 61, 32, 116, 97, 115, 107, 46, 105,
+    100, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 65, 78, 68, 32, 100, 101, 115, 99, 101,
+    110, 100, 97, 110, 116, 32, 61, 32, 63, 50, 41, 32, 32, 32, 32, 32, 32, 65, 83, 32, 105, 115, 95, 97, 99, 116, 105,
+    118, 101, 95, 116, 97, 115, 107, 95, 102, 97, 109, 105, 108, 121, 10, 70, 82, 79, 77, 32, 116, 97, 115, 107, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 76, 69, 70, 84, 32, 74, 79, 73, 78, 32, 116, 97, 115, 107, 95, 119, 111, 114, 107,
+    116, 105, 109, 101, 95, 116, 111, 116, 97, 108, 32, 65, 83, 32, 116, 111, 116, 97, 108, 32, 79, 78, 32, 116, 111,
+    116, 97, 108, 46, 116, 97, 115, 107, 95, 105, 100, 32, 61, 32, 116, 97, 115, 107, 46, 105, 100, 10, 87, 72, 69, 82,
+    69, 32, 116, 97, 115, 107, 46, 105, 100, 32, 61, 32, 63, 49, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
 };
 
 
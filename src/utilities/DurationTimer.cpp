@@ -37,7 +37,10 @@ DurationTimer::DurationTimer(const long long start_time_epoch_, const std::funct
     _start_time_epoch(start_time_epoch_), _on_update(on_update_
                                                          ? on_update_
                                                          : [] {
-                                                         }) { _thread = std::thread([&] { _threadProcess(); }); }
+                                                         })
+{
+    _tick_id = TickScheduler::subscribe([this](const std::chrono::sys_seconds now_) { _onTick(now_); });
+}
 
 DurationTimer::DurationTimer(const std::chrono::seconds start_time_epoch_,
                              const std::function<void()>& on_update_): DurationTimer(
@@ -47,8 +50,8 @@ DurationTimer::DurationTimer(const std::chrono::seconds start_time_epoch_,
 
 DurationTimer::~DurationTimer()
 {
-    _loop = false;
-    if (_thread.joinable()) { _thread.detach(); }
+    // 実行中のティックの終了を待つため、解除後にthisが参照されることはない。
+    TickScheduler::unsubscribe(_tick_id);
 }
 
 void DurationTimer::setStartEpoch(const long long start_time_epoch_)
@@ -58,15 +61,11 @@ void DurationTimer::setStartEpoch(const long long start_time_epoch_)
 
 void DurationTimer::setStartEpoch(const std::chrono::seconds start_time_epoch_)
 {
-    std::lock_guard lock(_update_text_mtx);
-    _start_time_epoch = start_time_epoch_;
+    _start_time_epoch = start_time_epoch_.count();
+    if (_active) _updateSeconds(std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now()));
 }
 
-const std::string& DurationTimer::getText()
-{
-    std::lock_guard lock(_update_text_mtx);
-    return _duration_text;
-}
+std::string DurationTimer::getText() const { return util::timeTextFromSeconds(getSeconds(), true); }
 
 void DurationTimer::setUpdateCallback(const std::function<void()>& on_update_)
 {
@@ -77,19 +76,29 @@ void DurationTimer::setUpdateCallback(const std::function<void()>& on_update_)
                      };
 }
 
-std::chrono::seconds DurationTimer::getSeconds() const { return _duration_seconds; }
+std::chrono::seconds DurationTimer::getSeconds() const { return std::chrono::seconds(_duration_seconds.load()); }
 
-void DurationTimer::stop() { _active = false; }
+void DurationTimer::stop()
+{
+    _active = false;
+    TickScheduler::setEnabled(_tick_id, false);
+}
 
 void DurationTimer::start()
 {
-    if (_active) return;
-    _active = true;
-    _active_condition.notify_one();
+    if (_active.exchange(true)) return;
+    _updateSeconds(std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now()));
+    TickScheduler::setEnabled(_tick_id, true);
 }
 
 bool DurationTimer::isActive() const { return _active; }
 
+void DurationTimer::markVisible()
+{
+    if (TickScheduler::markVisible(_tick_id) && _active)
+        _updateSeconds(std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now()));
+}
+
 void DurationTimer::_updateCallback() noexcept
 {
     try {
@@ -100,25 +109,14 @@ void DurationTimer::_updateCallback() noexcept
     }
 }
 
-void DurationTimer::_updateText()
+void DurationTimer::_updateSeconds(const std::chrono::sys_seconds now_)
 {
-    std::lock_guard lock(_update_text_mtx);
-    const auto now_time_point = std::chrono::system_clock::now();
-    const auto now_seconds = std::chrono::duration_cast<std::chrono::seconds>(now_time_point.time_since_epoch());
-    _duration_seconds = now_seconds - _start_time_epoch;
-    _duration_text = util::timeTextFromSeconds(_duration_seconds, true);
+    _duration_seconds = now_.time_since_epoch().count() - _start_time_epoch;
 }
 
-void DurationTimer::_threadProcess()
+void DurationTimer::_onTick(const std::chrono::sys_seconds now_)
 {
-    using namespace std::chrono_literals;
-    while (_loop) {
-        if (!_active) {
-            std::unique_lock lock(_stop_timer_mtx);
-            _active_condition.wait(lock, [&] { return _active; });
-        }
-        _updateText();
-        _updateCallback();
-        std::this_thread::sleep_for(500ms);
-    }
+    if (!_active) return;
+    _updateSeconds(now_);
+    _updateCallback();
 }
@@ -31,18 +31,21 @@
 
 #ifndef DURATIONTIMER_H
 #define DURATIONTIMER_H
+#include <atomic>
 #include <chrono>
-#include <condition_variable>
 #include <functional>
 #include <string>
-#include <thread>
 #include <mutex>
 
+#include "TickScheduler.h"
+
 
 /**
- * @brief ここにクラスの説明
- * @details ここにクラスの詳細な説明
- * @since
+ * @brief 開始時刻からの経過時間を計測するタイマーです。
+ * @details 経過時間はTickSchedulerのティックごとに更新し、アトミック変数として公開します。
+ * そのため、どのスレッドからもロックなしで読み取ることができます。
+ * 更新の通知(on_update_)はTickSchedulerのスレッドで行われます。
+ * @note 表示中のみ更新するため、描画のたびにmarkVisible()を呼び出してください。
  */
 class DurationTimer {
 public:
@@ -51,13 +54,17 @@ public:
     explicit DurationTimer(long long start_time_epoch_, const std::function<void()>& on_update_);
     explicit DurationTimer(std::chrono::seconds start_time_epoch_, const std::function<void()>& on_update_);
 
+    DurationTimer(const DurationTimer&) = delete;
+
+    DurationTimer& operator=(const DurationTimer&) = delete;
+
     ~DurationTimer();
 
     void setStartEpoch(long long start_time_epoch_);
 
     void setStartEpoch(std::chrono::seconds start_time_epoch_);
 
-    [[nodiscard]] const std::string& getText();
+    [[nodiscard]] std::string getText() const;
 
     void setUpdateCallback(const std::function<void()>& on_update_);
 
@@ -69,27 +76,31 @@ public:
 
     [[nodiscard]] bool isActive() const;
 
+    /**
+     * @brief タイマーが表示されていることを通知します。描画のたびに呼び出してください。
+     * @details 一定時間呼び出されない場合、ティックを受け取らなくなり、経過時間の更新と通知が止まります。
+     * 止まっていた場合は、経過時間を直ちに更新します。
+     */
+    void markVisible();
+
 private:
     void _updateCallback() noexcept;
 
-    void _updateText();
+    /**
+     * @brief now_時点の経過時間を公開します。
+     */
+    void _updateSeconds(std::chrono::sys_seconds now_);
 
-    void _threadProcess();
+    void _onTick(std::chrono::sys_seconds now_);
 
-    std::thread _thread;
-    std::chrono::seconds _start_time_epoch;
-    std::chrono::seconds _duration_seconds{};
-    std::string _duration_text{};
+    TickScheduler::TickId _tick_id;
+    std::atomic<long long> _start_time_epoch;
+    std::atomic<long long> _duration_seconds{0};
     std::function<void()> _on_update{};
 
-    std::mutex _update_text_mtx;
     std::mutex _on_update_mtx;
-    std::mutex _stop_timer_mtx;
-
-    std::condition_variable _active_condition;
-    bool _active{false};
 
-    bool _loop{true};
+    std::atomic<bool> _active{false};
 };
 
 
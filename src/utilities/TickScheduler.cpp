@@ -0,0 +1,138 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TickScheduler.h"
+
+#include <exception>
+#include <ranges>
+
+
+TickScheduler::TickId TickScheduler::subscribe(const TickCallback& on_tick_)
+{
+    std::lock_guard lock(_mtx);
+    const TickId id = _next_id++;
+    _entries.emplace(id, Entry{on_tick_ ? on_tick_ : [](std::chrono::sys_seconds) {}});
+    _ensureThreadLocked();
+    return id;
+}
+
+void TickScheduler::unsubscribe(const TickId id_)
+{
+    std::unique_lock lock(_mtx);
+    // 呼び出し中の関数から解除された場合は、自身の終了を待たない。
+    if (std::this_thread::get_id() != _thread.get_id())
+        _tick_done_condition.wait(lock, [&] { return _running_id != id_; });
+    _entries.erase(id_);
+}
+
+void TickScheduler::setEnabled(const TickId id_, const bool enabled_)
+{
+    std::lock_guard lock(_mtx);
+    const auto found = _entries.find(id_);
+    if (found == _entries.end() || found->second.enabled == enabled_) return;
+    found->second.enabled = enabled_;
+    if (enabled_) _condition.notify_all();
+}
+
+bool TickScheduler::markVisible(const TickId id_)
+{
+    const auto now = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+    std::lock_guard lock(_mtx);
+    const auto found = _entries.find(id_);
+    if (found == _entries.end()) return false;
+    const bool was_expired = found->second.visible_until < now;
+    found->second.visible_until = now + VISIBLE_LEASE;
+    if (was_expired) _condition.notify_all();
+    return was_expired;
+}
+
+void TickScheduler::stop()
+{
+    {
+        std::lock_guard lock(_mtx);
+        _loop = false;
+    }
+    _condition.notify_all();
+    if (_thread.joinable() && std::this_thread::get_id() != _thread.get_id()) _thread.join();
+}
+
+void TickScheduler::_threadProcess()
+{
+    std::unique_lock lock(_mtx);
+    while (_loop) {
+        // 呼び出す登録がなければ、登録・有効化・表示まで待機する。
+        const auto now = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+        if (!_hasRunnableLocked(now)) {
+            _condition.wait(lock, [&] {
+                return !_loop || _hasRunnableLocked(
+                    std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now()));
+            });
+            continue;
+        }
+
+        // 次の秒の境界まで待機する。待機中に登録が変わった場合は、境界を求め直す。
+        const auto next_tick = now + std::chrono::seconds(1);
+        if (_condition.wait_until(lock, next_tick) == std::cv_status::no_timeout) continue;
+
+        for (auto it = _entries.begin(); it != _entries.end() && _loop;) {
+            const TickId id = it->first;
+            if (!it->second.enabled || it->second.visible_until < next_tick) {
+                ++it;
+                continue;
+            }
+            // 呼び出し中は登録が解除されないため、ロックを外しても関数は有効なままである。
+            _running_id = id;
+            const TickCallback& on_tick = it->second.on_tick;
+            lock.unlock();
+            try { on_tick(next_tick); }
+            catch (const std::exception&) {
+            }
+            lock.lock();
+            _running_id = 0;
+            _tick_done_condition.notify_all();
+            it = _entries.upper_bound(id);
+        }
+    }
+}
+
+bool TickScheduler::_hasRunnableLocked(const std::chrono::sys_seconds now_)
+{
+    for (const auto& entry : _entries | std::views::values) {
+        if (entry.enabled && entry.visible_until >= now_) return true;
+    }
+    return false;
+}
+
+void TickScheduler::_ensureThreadLocked()
+{
+    if (_thread.joinable() || !_loop) return;
+    _thread = std::thread(&TickScheduler::_threadProcess);
+}
+
+std::mutex TickScheduler::_mtx;
+std::condition_variable TickScheduler::_condition;
+std::condition_variable TickScheduler::_tick_done_condition;
+std::map<TickScheduler::TickId, TickScheduler::Entry> TickScheduler::_entries;
+TickScheduler::TickId TickScheduler::_next_id{1};
+TickScheduler::TickId TickScheduler::_running_id{0};
+std::thread TickScheduler::_thread;
+bool TickScheduler::_loop{true};
@@ -0,0 +1,120 @@
+// MIT License
+//
+// Copyright (c) 2025 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/**
+ * @file TickScheduler.h
+ * @date 26/10/16
+ * @brief プロセス全体で共有する、1秒ごとのティックの配信
+ * @details 時刻の表示を更新するタイマーは、個別にスレッドを持たずにこのスケジューラへ登録します。
+ * @author saku shirakura (saku@sakushira.com)
+ */
+
+
+#ifndef TICKSCHEDULER_H
+#define TICKSCHEDULER_H
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
+
+/**
+ * @brief 登録された関数を、1つのスレッドから壁時計の秒の境界ごとに呼び出します。
+ * @details 登録した関数は、有効(setEnabled)であり、かつ表示中(markVisible)である間のみ呼び出されます。
+ * 表示中の扱いは期限付きで、描画のたびにmarkVisible()を呼び出すことで延長します。
+ * 呼び出す関数がなくなると、スレッドは次の登録・有効化・表示まで待機し、ティックを止めます。
+ * @note 呼び出しは全てスケジューラのスレッドで行われます。UIの状態を変更する場合はUIスレッドへ渡してください。
+ */
+class TickScheduler final {
+public:
+    TickScheduler() = delete;
+
+    using TickId = unsigned long long;
+
+    /**
+     * @brief ティックごとに呼び出す関数の型です。引数は境界となった時刻(秒)です。
+     */
+    using TickCallback = std::function<void(std::chrono::sys_seconds now_)>;
+
+    /**
+     * @brief ティックごとに呼び出す関数を登録します。登録直後は無効であり、setEnabled()で有効にしてください。
+     * @return 登録を識別するID
+     */
+    static TickId subscribe(const TickCallback& on_tick_);
+
+    /**
+     * @brief 登録を解除します。
+     * @details 関数の呼び出し中であれば、その終了を待ってから戻ります。戻った後に関数が呼び出されることはありません。
+     */
+    static void unsubscribe(TickId id_);
+
+    /**
+     * @brief ティックを受け取るかどうかを設定します。
+     */
+    static void setEnabled(TickId id_, bool enabled_);
+
+    /**
+     * @brief 登録した関数を表示中として扱う期限を延長します。描画のたびに呼び出してください。
+     * @return 期限が切れていた(ティックが止まっていた)場合はtrue
+     */
+    static bool markVisible(TickId id_);
+
+    /**
+     * @brief スレッドを終了します。アプリケーションの終了時に呼び出してください。
+     */
+    static void stop();
+
+private:
+    struct Entry {
+        TickCallback on_tick;
+        bool enabled{false};
+        // この時刻までのティックを表示中として扱う
+        std::chrono::sys_seconds visible_until{};
+    };
+
+    static void _threadProcess();
+
+    /**
+     * @brief now_のティックで呼び出す登録があるか判定します。
+     */
+    static bool _hasRunnableLocked(std::chrono::sys_seconds now_);
+
+    static void _ensureThreadLocked();
+
+    // 最後の描画から、ティックを止めるまでの秒数
+    static constexpr std::chrono::seconds VISIBLE_LEASE{2};
+
+    static std::mutex _mtx;
+    static std::condition_variable _condition;
+    static std::condition_variable _tick_done_condition;
+    static std::map<TickId, Entry> _entries;
+    static TickId _next_id;
+    // 呼び出し中の登録のID。呼び出し中でなければ0
+    static TickId _running_id;
+    static std::thread _thread;
+    static bool _loop;
+};
+
+
+#endif //TICKSCHEDULER_H
@@ -24,21 +24,11 @@
 
 #include <string>
 
-#include "Utilities.h"
-#include "../core/DBManager.h"
+#include "../core/SettingsStore.h"
 
 long long util::tz::fetchDifferenceSeconds()
 {
-    core::db::SettingTable tbl;
-    tbl.selectRecords("setting_key = 'timezone'", {});
-    if (tbl.getKeys().empty()) return 0;
-    const auto tz_config = tbl.getTable().at(tbl.getKeys().front()).value;
-    const int raw_difference = std::stoi(tz_config);
-    const int abs_difference = abs(raw_difference);
-    const int difference_min = fitInt(abs_difference % 100, 59, 0);
-    const int difference_hour = fitInt(abs_difference / 100 % 100, 24, 0);
-    const int difference = (difference_hour * 3600 + difference_min * 60) * (raw_difference < 0 ? -1 : 1);
-    return difference;
+    return core::SettingsStore::snapshot()->timezone_difference_seconds;
 }
 
 long long util::tz::addTimezoneValue(const long long _unix_epoch) { return _unix_epoch + fetchDifferenceSeconds(); }
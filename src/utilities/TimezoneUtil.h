@@ -33,6 +33,10 @@
 #define TIMZONEUTIL_H
 
 namespace util::tz {
+    /**
+     * @brief 設定されたタイムゾーンとUTCとの差を秒数で取得します。
+     * @details SettingsStoreが解析済みの値を返すため、データベースは読み取りません。
+     */
     long long fetchDifferenceSeconds();
 
     long long addTimezoneValue(long long _unix_epoch);